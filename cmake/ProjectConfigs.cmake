@@ -46,6 +46,11 @@ else()
     message(VERBOSE "Building without tests")
 endif()
 
+if (ENABLE_BENCHMARKS)
+    include(AddGoogleBenchmark)
+    message(VERBOSE "Building with benchmarks")
+endif()
+
 include(AddBoost)
 include(AddOpenSsl)
 include(AddSpdLog)
@@ -54,3 +59,13 @@ if(ENABLE_CLI OR ENABLE_TESTS)
     include(AddSndFile)
 endif()
 include(AddLibConfig)
+if(ENABLE_IO_URING)
+    include(AddLibUring)
+    # The sockets, acceptors and timers are run by io_uring instead of epoll reactor
+    add_compile_definitions(BOOST_ASIO_HAS_IO_URING BOOST_ASIO_DISABLE_EPOLL)
+    link_libraries(PkgConfig::LibUring)
+endif()
+if(ENABLE_AUDIO_CODECS)
+    include(AddFlac)
+    include(AddOpus)
+endif()
@@ -27,6 +27,14 @@ add_feature_info(
     ENABLE_TESTS ENABLE_TESTS "Build project with tests"
 )
 
+option(ENABLE_BENCHMARKS "Enable benchmarks" OFF)
+if(ENABLE_BENCHMARKS)
+    list(APPEND VCPKG_MANIFEST_FEATURES "benchmarks")
+endif()
+add_feature_info(
+    ENABLE_BENCHMARKS ENABLE_BENCHMARKS "Build project with benchmarks"
+)
+
 option(ENABLE_CLI "Enable CLI" OFF)
 if(ENABLE_CLI)
     list(APPEND VCPKG_MANIFEST_FEATURES "cli")
@@ -40,4 +48,28 @@ add_feature_info(
     ENABLE_WIT_SUPPORT ENABLE_WIT_SUPPORT "Build project with wit.ai support"
 )
 
+option(ENABLE_AUDIO_CODECS "Enable compressed audio codecs" ON)
+if(ENABLE_AUDIO_CODECS)
+    list(APPEND VCPKG_MANIFEST_FEATURES "codecs")
+endif()
+add_feature_info(
+    ENABLE_AUDIO_CODECS ENABLE_AUDIO_CODECS "Build project with FLAC and Opus audio decoding"
+)
+
+option(ENABLE_IO_URING "Enable io_uring backend" OFF)
+if(ENABLE_IO_URING)
+    list(APPEND VCPKG_MANIFEST_FEATURES "uring")
+endif()
+add_feature_info(
+    ENABLE_IO_URING ENABLE_IO_URING "Build project with io_uring backend of network I/O"
+)
+
+option(ENABLE_ASYNC_LOGGING "Enable asynchronous logging" ON)
+add_feature_info(
+    ENABLE_ASYNC_LOGGING ENABLE_ASYNC_LOGGING "Build project with logging over background thread"
+)
+
+set(LOGGING_ACTIVE_LEVEL "debug" CACHE STRING "Logging level below which logging calls are compiled out")
+set_property(CACHE LOGGING_ACTIVE_LEVEL PROPERTY STRINGS trace debug info warn error critical off)
+
 feature_summary(WHAT ALL)
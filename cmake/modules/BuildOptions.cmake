@@ -23,6 +23,9 @@ option(ENABLE_SEPARATING_DEBUG_SYMBOLS
 option(ENABLE_GOLD_LINKED
        "Enable gold linger"
        OFF)
+option(ENABLE_TSAN
+       "Enable thread sanitizer"
+       OFF)
 
 if(ENABLE_COMPILER_CHECKING)
     if (MSVC)
@@ -32,6 +35,21 @@ if(ENABLE_COMPILER_CHECKING)
     endif()
 endif()
 
+if(ENABLE_TSAN)
+    add_compile_options(-fsanitize=thread -fno-omit-frame-pointer)
+    add_link_options(-fsanitize=thread)
+    if (CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        # The fences of async logging sink (used only to wake up the background thread) are
+        # not modeled by sanitizer
+        add_compile_options(-Wno-tsan)
+    endif()
+endif()
+
+if(DEFINED LOGGING_ACTIVE_LEVEL)
+    string(TOUPPER ${LOGGING_ACTIVE_LEVEL} _LOGGING_ACTIVE_LEVEL)
+    add_compile_definitions(SPDLOG_ACTIVE_LEVEL=SPDLOG_LEVEL_${_LOGGING_ACTIVE_LEVEL})
+endif()
+
 if (ENABLE_SEPARATING_DEBUG_SYMBOLS)
     check_c_compiler_flag("-gsplit-dwarf" HAVE_SPLIT_DWARF)
     if (HAVE_SPLIT_DWARF)
@@ -16,6 +16,7 @@
 
 #include "common/ServiceLogger.hpp"
 #include "intent/IntentSubsystem.hpp"
+#include "intent/ScriptLauncher.hpp"
 
 namespace jar {
 
@@ -28,6 +29,9 @@ ServiceApplication::name() const
 void
 ServiceApplication::initialize(Application& application)
 {
+    /* The launcher of scripts is forked first while the process is still single-threaded */
+    ScriptLauncher::install(ScriptLauncher::create());
+
     ServiceLogger logger{"RINTENTO"};
     logger.create("MAIN", SPDLOG_LEVEL_DEBUG);
 
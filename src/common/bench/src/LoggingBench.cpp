@@ -0,0 +1,112 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "common/AsyncSink.hpp"
+
+#include <spdlog/logger.h>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/basic_file_sink.h>
+
+#include <memory>
+
+using namespace jar;
+
+namespace {
+
+/* The typical size of speech chunk sent by clients */
+constexpr std::size_t kChunkSize = 3200;
+
+std::shared_ptr<spdlog::logger>
+createLogger(spdlog::sink_ptr sink, spdlog::level::level_enum level)
+{
+    auto logger = std::make_shared<spdlog::logger>("BENCH", std::move(sink));
+    logger->set_level(level);
+    return logger;
+}
+
+spdlog::sink_ptr
+createFileSink()
+{
+    return std::make_shared<spdlog::sinks::basic_file_sink_mt>("/dev/null");
+}
+
+} // namespace
+
+/* The trace call below the active level is compiled out */
+static void
+BM_LogChunkStripped(benchmark::State& state)
+{
+    const auto logger = createLogger(createFileSink(), spdlog::level::trace);
+    std::size_t chunk{};
+    for (auto _ : state) {
+        SPDLOG_LOGGER_TRACE(logger, "Send speech chunk: index<{}>, size<{}>", chunk++, kChunkSize);
+        benchmark::DoNotOptimize(chunk);
+    }
+}
+BENCHMARK(BM_LogChunkStripped);
+
+/* The call is compiled in but the level is off at runtime */
+static void
+BM_LogChunkFiltered(benchmark::State& state)
+{
+    const auto logger = createLogger(createFileSink(), spdlog::level::info);
+    std::size_t chunk{};
+    for (auto _ : state) {
+        logger->debug("Send speech chunk: index<{}>, size<{}>", chunk++, kChunkSize);
+        benchmark::DoNotOptimize(chunk);
+    }
+}
+BENCHMARK(BM_LogChunkFiltered);
+
+/* The message is formatted and written on calling thread */
+static void
+BM_LogChunkSync(benchmark::State& state)
+{
+    static std::shared_ptr<spdlog::logger> logger;
+    if (state.thread_index() == 0) {
+        logger = createLogger(createFileSink(), spdlog::level::debug);
+    }
+    std::size_t chunk{};
+    for (auto _ : state) {
+        logger->debug("Send speech chunk: index<{}>, size<{}>", chunk++, kChunkSize);
+    }
+    if (state.thread_index() == 0) {
+        logger.reset();
+    }
+}
+BENCHMARK(BM_LogChunkSync)->Threads(1)->Threads(4);
+
+/* The message is enqueued and written by background thread */
+static void
+BM_LogChunkAsync(benchmark::State& state)
+{
+    static std::shared_ptr<spdlog::logger> logger;
+    static std::shared_ptr<AsyncSink> sink;
+    if (state.thread_index() == 0) {
+        sink = std::make_shared<AsyncSink>(createFileSink());
+        logger = createLogger(sink, spdlog::level::debug);
+    }
+    std::size_t chunk{};
+    for (auto _ : state) {
+        logger->debug("Send speech chunk: index<{}>, size<{}>", chunk++, kChunkSize);
+    }
+    if (state.thread_index() == 0) {
+        state.counters["dropped"] = static_cast<double>(sink->dropped());
+        logger.reset();
+        sink.reset();
+    }
+}
+BENCHMARK(BM_LogChunkAsync)->Threads(1)->Threads(4);
\ No newline at end of file
@@ -0,0 +1,75 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "common/MpmcQueue.hpp"
+
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/sinks/sink.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace jar {
+
+/**
+ * The sink passing messages over lock-free queue to the background thread which
+ * writes them into given sink. The logging thread never blocks: upon the queue is full
+ * the message is dropped (and counted).
+ */
+class AsyncSink final : public spdlog::sinks::sink {
+public:
+    static constexpr std::size_t kDefaultCapacity = 8192;
+
+    explicit AsyncSink(spdlog::sink_ptr sink, std::size_t capacity = kDefaultCapacity);
+
+    ~AsyncSink() override;
+
+    void
+    log(const spdlog::details::log_msg& msg) override;
+
+    void
+    flush() override;
+
+    void
+    set_pattern(const std::string& pattern) override;
+
+    void
+    set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+    [[nodiscard]] std::uint64_t
+    dropped() const;
+
+private:
+    void
+    wakeUp();
+
+    void
+    run(const std::stop_token& token);
+
+    bool
+    drain();
+
+private:
+    spdlog::sink_ptr _sink;
+    MpmcQueue<spdlog::details::log_msg_buffer> _queue;
+    std::atomic<std::uint64_t> _dropped{};
+    std::atomic<bool> _sleeping{false};
+    std::jthread _thread;
+};
+
+} // namespace jar
\ No newline at end of file
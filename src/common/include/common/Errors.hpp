@@ -0,0 +1,49 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <jarvisto/network/Asio.hpp>
+
+#include <type_traits>
+
+namespace jar {
+
+enum class RecognitionErrc {
+    /* Unable to connect or establish secure connection with backend */
+    ConnectFailed = 1,
+    /* Backend responded by server error (5xx) status code */
+    ServerError,
+    /* Backend throttled the request (429) */
+    Throttled,
+    /* The request can't be sent within max wait due to rate limit */
+    RateLimited,
+    /* Backend is considered unavailable (requests fail fast) */
+    Unavailable,
+};
+
+[[nodiscard]] const sys::error_category&
+recognitionCategory() noexcept;
+
+[[nodiscard]] sys::error_code
+make_error_code(RecognitionErrc errc) noexcept;
+
+/* Whether the recognition might succeed being repeated using another backend connection */
+[[nodiscard]] bool
+isRetryable(const sys::error_code& ec) noexcept;
+
+} // namespace jar
+
+template<>
+struct boost::system::is_error_code_enum<jar::RecognitionErrc> : std::true_type { };
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include "coro/BoundedChannel.hpp"
 
 #include <memory>
+#include <string>
 
 namespace jar {
 
@@ -31,13 +32,15 @@ public:
     canRecognizeMessage() const
         = 0;
 
+    /* Creates the recognition of given complete message */
     [[nodiscard]] virtual std::shared_ptr<Recognition>
-    message(io::any_io_executor executor, std::shared_ptr<DataChannel> channel) = 0;
+    message(io::any_io_executor executor, std::string message) = 0;
 
     [[nodiscard]] virtual bool
     canRecognizeSpeech() const
         = 0;
 
+    /* Creates the recognition of speech streamed through given channel */
     [[nodiscard]] virtual std::shared_ptr<Recognition>
     speech(io::any_io_executor executor, std::shared_ptr<DataChannel> channel) = 0;
 };
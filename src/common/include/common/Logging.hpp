@@ -0,0 +1,41 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <spdlog/common.h>
+
+/**
+ * The logging calls below the active level (SPDLOG_ACTIVE_LEVEL given by LOGGING_ACTIVE_LEVEL
+ * build option) are compiled out entirely, so the arguments are neither evaluated nor formatted.
+ */
+
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_TRACE
+#ifdef LOGT
+#undef LOGT
+#endif
+#define LOGT(...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_DEBUG
+#undef LOGD
+#define LOGD(...) ((void)0)
+#endif
+
+#if SPDLOG_ACTIVE_LEVEL > SPDLOG_LEVEL_INFO
+#undef LOGI
+#define LOGI(...) ((void)0)
+#endif
\ No newline at end of file
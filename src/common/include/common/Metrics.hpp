@@ -0,0 +1,124 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace jar {
+
+class Counter {
+public:
+    void
+    increment(std::uint64_t value = 1) noexcept;
+
+    [[nodiscard]] std::uint64_t
+    value() const noexcept;
+
+private:
+    std::atomic<std::uint64_t> _value{};
+};
+
+class Gauge {
+public:
+    void
+    set(std::int64_t value) noexcept;
+
+    void
+    increment(std::int64_t value = 1) noexcept;
+
+    void
+    decrement(std::int64_t value = 1) noexcept;
+
+    [[nodiscard]] std::int64_t
+    value() const noexcept;
+
+private:
+    std::atomic<std::int64_t> _value{};
+};
+
+/**
+ * Distribution of observed values over the buckets with given upper bounds
+ * (the last implicit bucket holds values above the greatest bound).
+ */
+class Histogram {
+public:
+    struct Snapshot {
+        std::vector<double> bounds;
+        std::vector<std::uint64_t> counts;
+        std::uint64_t count{};
+        double sum{};
+    };
+
+    explicit Histogram(std::vector<double> bounds);
+
+    void
+    observe(double value) noexcept;
+
+    [[nodiscard]] Snapshot
+    snapshot() const;
+
+private:
+    std::vector<double> _bounds;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> _counts;
+    std::atomic<std::uint64_t> _count{};
+    std::atomic<double> _sum{};
+};
+
+/**
+ * Process wide registry of named metrics. The returned references stay valid
+ * for the whole process lifetime, so it's expected to look up metric once and keep it.
+ */
+class Metrics {
+public:
+    struct Snapshot {
+        std::map<std::string, std::uint64_t> counters;
+        std::map<std::string, std::int64_t> gauges;
+        std::map<std::string, Histogram::Snapshot> histograms;
+    };
+
+    static Metrics&
+    instance();
+
+    [[nodiscard]] Counter&
+    counter(std::string_view name);
+
+    [[nodiscard]] Gauge&
+    gauge(std::string_view name);
+
+    /* The bounds are used only upon the first request of histogram with given name */
+    [[nodiscard]] Histogram&
+    histogram(std::string_view name, std::vector<double> bounds);
+
+    [[nodiscard]] Snapshot
+    snapshot() const;
+
+private:
+    Metrics() = default;
+
+private:
+    mutable std::mutex _guard;
+    std::map<std::string, std::unique_ptr<Counter>, std::less<>> _counters;
+    std::map<std::string, std::unique_ptr<Gauge>, std::less<>> _gauges;
+    std::map<std::string, std::unique_ptr<Histogram>, std::less<>> _histograms;
+};
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,117 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace jar {
+
+/**
+ * The lock-free bounded queue of multiple producers and consumers (D. Vyukov's algorithm).
+ * The capacity is rounded up to the power of two, no push or pop operation ever blocks.
+ */
+template<typename T>
+class MpmcQueue {
+public:
+    explicit MpmcQueue(std::size_t capacity)
+        : _mask{std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1}
+        , _cells{std::make_unique<Cell[]>(_mask + 1)}
+    {
+        for (std::size_t n = 0; n <= _mask; ++n) {
+            _cells[n].sequence.store(n, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue&
+    operator=(const MpmcQueue&) = delete;
+
+    [[nodiscard]] std::size_t
+    capacity() const
+    {
+        return _mask + 1;
+    }
+
+    /* Returns false if the queue is full */
+    template<typename U>
+    [[nodiscard]] bool
+    tryPush(U&& value)
+    {
+        Cell* cell{};
+        std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::forward<U>(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /* Returns false if the queue is empty */
+    [[nodiscard]] bool
+    tryPop(T& value)
+    {
+        Cell* cell{};
+        std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff
+                = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->value);
+        cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    const std::size_t _mask;
+    std::unique_ptr<Cell[]> _cells;
+    /* The producers and consumers positions live on separate cache lines */
+    alignas(64) std::atomic<std::size_t> _enqueuePos{0};
+    alignas(64) std::atomic<std::size_t> _dequeuePos{0};
+};
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,135 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/AsyncSink.hpp"
+
+#include "common/Metrics.hpp"
+
+#include <boost/assert.hpp>
+
+namespace jar {
+
+namespace {
+
+Counter&
+droppedCounter()
+{
+    static Counter& counter{Metrics::instance().counter("logging.dropped")};
+    return counter;
+}
+
+} // namespace
+
+AsyncSink::AsyncSink(spdlog::sink_ptr sink, const std::size_t capacity)
+    : _sink{std::move(sink)}
+    , _queue{capacity}
+{
+    BOOST_ASSERT(_sink);
+    /* The level is filtered out by this sink before enqueuing */
+    _sink->set_level(spdlog::level::trace);
+    _thread = std::jthread{[this](const std::stop_token& token) { run(token); }};
+}
+
+AsyncSink::~AsyncSink()
+{
+    _thread.request_stop();
+    wakeUp();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void
+AsyncSink::log(const spdlog::details::log_msg& msg)
+{
+    /* The message refers to the caller memory, so it's copied into the buffer */
+    if (not _queue.tryPush(spdlog::details::log_msg_buffer{msg})) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        droppedCounter().increment();
+        return;
+    }
+    wakeUp();
+}
+
+void
+AsyncSink::flush()
+{
+    /* The background thread flushes the sink after each portion of messages */
+    wakeUp();
+}
+
+void
+AsyncSink::set_pattern(const std::string& pattern)
+{
+    _sink->set_pattern(pattern);
+}
+
+void
+AsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> formatter)
+{
+    _sink->set_formatter(std::move(formatter));
+}
+
+std::uint64_t
+AsyncSink::dropped() const
+{
+    return _dropped.load(std::memory_order_relaxed);
+}
+
+void
+AsyncSink::wakeUp()
+{
+    /* Pairs with the fence of background thread to never miss the wake up (the syscall
+       is made only if the background thread is going to sleep) */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_sleeping.load(std::memory_order_relaxed)
+        and _sleeping.exchange(false, std::memory_order_relaxed)) {
+        _sleeping.notify_one();
+    }
+}
+
+void
+AsyncSink::run(const std::stop_token& token)
+{
+    while (not token.stop_requested()) {
+        if (drain()) {
+            continue;
+        }
+        _sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (drain() or token.stop_requested()) {
+            _sleeping.store(false, std::memory_order_relaxed);
+            continue;
+        }
+        _sleeping.wait(true, std::memory_order_relaxed);
+    }
+    drain();
+}
+
+bool
+AsyncSink::drain()
+{
+    bool drained{false};
+    spdlog::details::log_msg_buffer msg;
+    while (_queue.tryPop(msg)) {
+        _sink->log(msg);
+        drained = true;
+    }
+    if (drained) {
+        _sink->flush();
+    }
+    return drained;
+}
+
+} // namespace jar
\ No newline at end of file
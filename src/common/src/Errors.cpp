@@ -0,0 +1,72 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/Errors.hpp"
+
+#include <string>
+
+namespace jar {
+
+namespace {
+
+class RecognitionCategory final : public sys::error_category {
+public:
+    [[nodiscard]] const char*
+    name() const noexcept final
+    {
+        return "recognition";
+    }
+
+    [[nodiscard]] std::string
+    message(int value) const final
+    {
+        switch (static_cast<RecognitionErrc>(value)) {
+        case RecognitionErrc::ConnectFailed:
+            return "Unable to connect to backend";
+        case RecognitionErrc::ServerError:
+            return "Backend server error";
+        case RecognitionErrc::Throttled:
+            return "Backend throttled the request";
+        case RecognitionErrc::RateLimited:
+            return "Request rate limit is exceeded";
+        case RecognitionErrc::Unavailable:
+            return "Backend is unavailable";
+        }
+        return "Unknown recognition error";
+    }
+};
+
+} // namespace
+
+const sys::error_category&
+recognitionCategory() noexcept
+{
+    static const RecognitionCategory category;
+    return category;
+}
+
+sys::error_code
+make_error_code(RecognitionErrc errc) noexcept
+{
+    return sys::error_code{static_cast<int>(errc), recognitionCategory()};
+}
+
+bool
+isRetryable(const sys::error_code& ec) noexcept
+{
+    return (ec == RecognitionErrc::ConnectFailed or ec == RecognitionErrc::ServerError
+            or ec == RecognitionErrc::Throttled);
+}
+
+} // namespace jar
\ No newline at end of file
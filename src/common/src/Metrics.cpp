@@ -0,0 +1,149 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/Metrics.hpp"
+
+#include <algorithm>
+
+namespace jar {
+
+namespace {
+
+template<typename T, typename... Args>
+T&
+getOrCreate(std::map<std::string, std::unique_ptr<T>, std::less<>>& metrics,
+            std::string_view name,
+            Args&&... args)
+{
+    auto it = metrics.find(name);
+    if (it == metrics.end()) {
+        it = metrics.emplace(name, std::make_unique<T>(std::forward<Args>(args)...)).first;
+    }
+    return *it->second;
+}
+
+} // namespace
+
+void
+Counter::increment(std::uint64_t value) noexcept
+{
+    _value.fetch_add(value, std::memory_order_relaxed);
+}
+
+std::uint64_t
+Counter::value() const noexcept
+{
+    return _value.load(std::memory_order_relaxed);
+}
+
+void
+Gauge::set(std::int64_t value) noexcept
+{
+    _value.store(value, std::memory_order_relaxed);
+}
+
+void
+Gauge::increment(std::int64_t value) noexcept
+{
+    _value.fetch_add(value, std::memory_order_relaxed);
+}
+
+void
+Gauge::decrement(std::int64_t value) noexcept
+{
+    _value.fetch_sub(value, std::memory_order_relaxed);
+}
+
+std::int64_t
+Gauge::value() const noexcept
+{
+    return _value.load(std::memory_order_relaxed);
+}
+
+Histogram::Histogram(std::vector<double> bounds)
+    : _bounds{std::move(bounds)}
+    , _counts{std::make_unique<std::atomic<std::uint64_t>[]>(_bounds.size() + 1)}
+{
+    std::ranges::sort(_bounds);
+}
+
+void
+Histogram::observe(double value) noexcept
+{
+    const auto index = std::ranges::lower_bound(_bounds, value) - _bounds.begin();
+    _counts[static_cast<std::size_t>(index)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+Histogram::Snapshot
+Histogram::snapshot() const
+{
+    Snapshot output;
+    output.bounds = _bounds;
+    output.counts.reserve(_bounds.size() + 1);
+    for (std::size_t n = 0; n <= _bounds.size(); ++n) {
+        output.counts.push_back(_counts[n].load(std::memory_order_relaxed));
+    }
+    output.count = _count.load(std::memory_order_relaxed);
+    output.sum = _sum.load(std::memory_order_relaxed);
+    return output;
+}
+
+Metrics&
+Metrics::instance()
+{
+    static Metrics metrics;
+    return metrics;
+}
+
+Counter&
+Metrics::counter(std::string_view name)
+{
+    std::lock_guard lock{_guard};
+    return getOrCreate(_counters, name);
+}
+
+Gauge&
+Metrics::gauge(std::string_view name)
+{
+    std::lock_guard lock{_guard};
+    return getOrCreate(_gauges, name);
+}
+
+Histogram&
+Metrics::histogram(std::string_view name, std::vector<double> bounds)
+{
+    std::lock_guard lock{_guard};
+    return getOrCreate(_histograms, name, std::move(bounds));
+}
+
+Metrics::Snapshot
+Metrics::snapshot() const
+{
+    std::lock_guard lock{_guard};
+    Snapshot output;
+    for (const auto& [name, counter] : _counters) {
+        output.counters.emplace(name, counter->value());
+    }
+    for (const auto& [name, gauge] : _gauges) {
+        output.gauges.emplace(name, gauge->value());
+    }
+    for (const auto& [name, histogram] : _histograms) {
+        output.histograms.emplace(name, histogram->snapshot());
+    }
+    return output;
+}
+
+} // namespace jar
\ No newline at end of file
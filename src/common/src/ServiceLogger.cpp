@@ -14,6 +14,14 @@
 
 #include "common/ServiceLogger.hpp"
 
+#include "rintento/Options.hpp"
+#ifdef ENABLE_ASYNC_LOGGING
+#include "common/AsyncSink.hpp"
+
+#include <spdlog/logger.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#endif
+
 namespace jar {
 
 ServiceLogger::ServiceLogger(std::string ident)
@@ -24,7 +32,15 @@ ServiceLogger::ServiceLogger(std::string ident)
 void
 ServiceLogger::addSinks(std::shared_ptr<spdlog::logger> logger, const int logLevel)
 {
+#ifdef ENABLE_ASYNC_LOGGING
+    /* The console is written by background thread to never block the logging threads */
+    auto console = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+    auto sink = std::make_shared<AsyncSink>(std::move(console));
+    sink->set_level(static_cast<spdlog::level::level_enum>(logLevel));
+    logger->sinks().push_back(std::move(sink));
+#else
     addConsoleSink(std::move(logger), logLevel);
+#endif
 }
 
 } // namespace jar
\ No newline at end of file
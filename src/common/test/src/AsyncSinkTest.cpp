@@ -0,0 +1,69 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "common/AsyncSink.hpp"
+
+#include <spdlog/logger.h>
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <algorithm>
+#include <sstream>
+
+using namespace testing;
+using namespace jar;
+
+TEST(AsyncSinkTest, Write)
+{
+    std::ostringstream output;
+    {
+        auto sink = std::make_shared<AsyncSink>(
+            std::make_shared<spdlog::sinks::ostream_sink_mt>(output));
+        sink->set_level(spdlog::level::info);
+        spdlog::logger logger{"TEST", sink};
+        logger.set_pattern("%v");
+        logger.set_level(spdlog::level::trace);
+
+        logger.debug("Skipped");
+        for (int n = 0; n < 3; ++n) {
+            logger.info("Message <{}>", n);
+        }
+        EXPECT_EQ(sink->dropped(), 0);
+    }
+    /* The messages are written before the sink is destroyed */
+    EXPECT_EQ(output.str(), "Message <0>\nMessage <1>\nMessage <2>\n");
+}
+
+TEST(AsyncSinkTest, Overflow)
+{
+    static constexpr int kMessages = 10000;
+
+    std::ostringstream output;
+    std::uint64_t dropped{};
+    {
+        auto sink = std::make_shared<AsyncSink>(
+            std::make_shared<spdlog::sinks::ostream_sink_mt>(output), 2);
+        spdlog::logger logger{"TEST", sink};
+        logger.set_pattern("%v");
+
+        for (int n = 0; n < kMessages; ++n) {
+            logger.info("Message <{}>", n);
+        }
+        dropped = sink->dropped();
+    }
+    /* The messages which don't fit the queue are dropped instead of blocking */
+    const auto written = std::ranges::count(output.str(), '\n');
+    EXPECT_EQ(written + dropped, kMessages);
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "common/MpmcQueue.hpp"
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+using namespace jar;
+
+TEST(MpmcQueueTest, PushPop)
+{
+    MpmcQueue<int> queue{3};
+    EXPECT_EQ(queue.capacity(), 4);
+
+    int value{};
+    EXPECT_FALSE(queue.tryPop(value));
+    for (int n = 0; n < 4; ++n) {
+        EXPECT_TRUE(queue.tryPush(n));
+    }
+    EXPECT_FALSE(queue.tryPush(4));
+
+    for (int n = 0; n < 4; ++n) {
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, n);
+    }
+    EXPECT_FALSE(queue.tryPop(value));
+    EXPECT_TRUE(queue.tryPush(5));
+}
+
+TEST(MpmcQueueTest, Concurrent)
+{
+    static constexpr int kProducers = 4;
+    static constexpr int kValues = 10000;
+
+    MpmcQueue<int> queue{64};
+    std::atomic<long> sum{};
+    std::atomic<int> popped{};
+
+    std::vector<std::jthread> threads;
+    for (int p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&]() {
+            for (int n = 1; n <= kValues; ++n) {
+                while (not queue.tryPush(n)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&]() {
+            int value{};
+            while (popped.load() < kProducers * kValues) {
+                if (queue.tryPop(value)) {
+                    sum += value;
+                    ++popped;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    threads.clear();
+
+    EXPECT_EQ(popped, kProducers * kValues);
+    EXPECT_EQ(sum, kProducers * (long{kValues} * (kValues + 1) / 2));
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "common/IRecognitionFactory.hpp"
+#include "intent/AutomationPerformer.hpp"
+#include "intent/AutomationRegistry.hpp"
+#include "intent/RecognitionServer.hpp"
+
+#include <jarvisto/network/Http.hpp>
+
+#include <memory>
+#include <thread>
+
+using namespace jar;
+
+namespace {
+
+class NullRecognitionFactory final : public IRecognitionFactory {
+public:
+    [[nodiscard]] bool
+    canRecognizeMessage() const final
+    {
+        return false;
+    }
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    message(io::any_io_executor /*executor*/, std::string /*message*/) final
+    {
+        return {};
+    }
+
+    [[nodiscard]] bool
+    canRecognizeSpeech() const final
+    {
+        return false;
+    }
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    speech(io::any_io_executor /*executor*/, std::shared_ptr<DataChannel> /*channel*/) final
+    {
+        return {};
+    }
+};
+
+/* The reactor is chosen at build time (see ENABLE_IO_URING option) */
+const char*
+backendName()
+{
+#if defined(BOOST_ASIO_HAS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL)
+    return "io_uring";
+#else
+    return "epoll";
+#endif
+}
+
+class Server {
+public:
+    explicit Server(const tcp::endpoint& endpoint)
+        : _guard{io::make_work_guard(_context)}
+    {
+        _server = RecognitionServer::create(
+            _context.get_executor(),
+            std::make_shared<NullRecognitionFactory>(),
+            AutomationPerformer::create(_context.get_executor(),
+                                        std::make_shared<AutomationRegistry>()));
+        _endpoint = _server->listen(endpoint);
+        _thread = std::thread{[this]() { _context.run(); }};
+    }
+
+    ~Server()
+    {
+        _context.stop();
+        _thread.join();
+    }
+
+    [[nodiscard]] const tcp::endpoint&
+    endpoint() const
+    {
+        return _endpoint;
+    }
+
+private:
+    io::io_context _context;
+    io::executor_work_guard<io::io_context::executor_type> _guard;
+    RecognitionServer::Ptr _server;
+    tcp::endpoint _endpoint;
+    std::thread _thread;
+};
+
+void
+sendRequest(io::io_context& context, const tcp::endpoint& endpoint)
+{
+    tcp::socket socket{context};
+    socket.connect(endpoint);
+    http::request<http::empty_body> request{http::verb::get, "/unknown", kHttpVersion11};
+    http::write(socket, request);
+    beast::flat_buffer buffer;
+    http::response<http::string_body> response;
+    http::read(socket, buffer, response);
+}
+
+} // namespace
+
+/* Measures the request throughput of server (build with and without io_uring to compare) */
+static void
+BM_RequestThroughput(benchmark::State& state)
+{
+    static std::unique_ptr<Server> server;
+
+    if (state.thread_index() == 0) {
+        /* The port is chosen by system (the server is listening once created) */
+        server = std::make_unique<Server>(tcp::endpoint{io::ip::make_address("127.0.0.1"), 0});
+    }
+
+    io::io_context context;
+    for (auto _ : state) {
+        /* The threads start measuring at once after the server is created */
+        sendRequest(context, server->endpoint());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(backendName());
+
+    if (state.thread_index() == 0) {
+        server.reset();
+    }
+}
+
+BENCHMARK(BM_RequestThroughput)->Threads(1)->Threads(4)->UseRealTime();
\ No newline at end of file
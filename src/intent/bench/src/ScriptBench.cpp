@@ -0,0 +1,70 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "intent/ScriptAction.hpp"
+#include "intent/ScriptLauncher.hpp"
+
+#include <cstddef>
+#include <vector>
+
+using namespace jar;
+
+namespace {
+
+/* The launcher is forked before main() while the process is still single-threaded */
+const ScriptLauncher::Ptr gLauncher = ScriptLauncher::create();
+
+} // namespace
+
+/* Measures the latency of script spawn through the launcher process or directly by fork/exec of
+   the service (the arguments are the usage of launcher and the size of service memory in MiB) */
+static void
+BM_ScriptSpawn(benchmark::State& state)
+{
+    const bool useLauncher = (state.range(0) != 0);
+    if (useLauncher and not gLauncher) {
+        state.SkipWithError("Launcher is not available");
+        return;
+    }
+
+    /* The resident memory makes the fork of service more expensive (the page tables are copied) */
+    const std::vector<char> ballast(static_cast<std::size_t>(state.range(1)) << 20, 1);
+    benchmark::DoNotOptimize(ballast.data());
+
+    ScriptLauncher::install(useLauncher ? gLauncher : ScriptLauncher::Ptr{});
+    io::io_context context;
+    ScriptAction::Params params;
+    params.exec = "true";
+    for (auto _ : state) {
+        std::error_code result;
+        io::co_spawn(context,
+                     ScriptAction::run(params, context.get_executor()),
+                     [&](auto, auto ec) { result = ec; });
+        context.run();
+        context.restart();
+        if (result) {
+            state.SkipWithError("Unable to run script");
+            break;
+        }
+    }
+    ScriptLauncher::install({});
+}
+
+BENCHMARK(BM_ScriptSpawn)
+    ->ArgNames({"launcher", "memory_mb"})
+    ->ArgsProduct({{0, 1}, {0, 512}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
\ No newline at end of file
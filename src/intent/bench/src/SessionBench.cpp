@@ -0,0 +1,141 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "common/IRecognitionFactory.hpp"
+#include "intent/AutomationPerformer.hpp"
+#include "intent/AutomationRegistry.hpp"
+#include "intent/RecognitionServer.hpp"
+
+#include <jarvisto/network/Http.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+using namespace jar;
+
+namespace {
+
+/* The allocations are counted only on the threads serving the sessions */
+thread_local bool gTracked{false};
+std::atomic<std::size_t> gAllocations{0};
+
+class NullRecognitionFactory final : public IRecognitionFactory {
+public:
+    [[nodiscard]] bool
+    canRecognizeMessage() const final
+    {
+        return false;
+    }
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    message(io::any_io_executor /*executor*/, std::string /*message*/) final
+    {
+        return {};
+    }
+
+    [[nodiscard]] bool
+    canRecognizeSpeech() const final
+    {
+        return false;
+    }
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    speech(io::any_io_executor /*executor*/, std::shared_ptr<DataChannel> /*channel*/) final
+    {
+        return {};
+    }
+};
+
+void
+sendRequest(io::io_context& context, const tcp::endpoint& endpoint)
+{
+    tcp::socket socket{context};
+    socket.connect(endpoint);
+    http::request<http::empty_body> request{http::verb::get, "/unknown", kHttpVersion11};
+    http::write(socket, request);
+    beast::flat_buffer buffer;
+    http::response<http::string_body> response;
+    http::read(socket, buffer, response);
+}
+
+} // namespace
+
+void*
+operator new(std::size_t size)
+{
+    if (gTracked) {
+        gAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* ptr = std::malloc(size); ptr) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+/* Measures the allocations of server per request (the argument is the session pool size) */
+static void
+BM_SessionRequest(benchmark::State& state)
+{
+    io::io_context serverContext;
+    SessionOptions options;
+    options.sessionPoolSize = static_cast<std::size_t>(state.range(0));
+    auto server = RecognitionServer::create(
+        serverContext.get_executor(),
+        std::make_shared<NullRecognitionFactory>(),
+        AutomationPerformer::create(serverContext.get_executor(),
+                                    std::make_shared<AutomationRegistry>()),
+        options);
+    const auto endpoint = server->listen(tcp::endpoint{io::ip::make_address("127.0.0.1"), 0});
+    auto guard = io::make_work_guard(serverContext);
+    std::thread worker{[&serverContext]() {
+        gTracked = true;
+        serverContext.run();
+    }};
+
+    io::io_context clientContext;
+    /* Warm up the pool and lazily initialized state */
+    for (int n = 0; n < 8; ++n) {
+        sendRequest(clientContext, endpoint);
+    }
+
+    std::size_t requests{};
+    const std::size_t allocations = gAllocations.load();
+    for (auto _ : state) {
+        sendRequest(clientContext, endpoint);
+        requests++;
+    }
+    state.counters["allocs_per_request"] = benchmark::Counter(
+        static_cast<double>(gAllocations.load() - allocations) / static_cast<double>(requests));
+
+    serverContext.stop();
+    worker.join();
+}
+
+BENCHMARK(BM_SessionRequest)->Arg(0)->Arg(64)->UseRealTime();
\ No newline at end of file
@@ -19,10 +19,15 @@
 #include <jarvisto/network/Asio.hpp>
 
 #include <memory>
+#include <system_error>
 #include <vector>
 
 namespace jar {
 
+/**
+ * The action of automation. The action is run as a coroutine: the cancellation of awaiting
+ * coroutine reaches the operation being run by the action (e.g. the program is terminated).
+ */
 class Action : public DeferredJob {
 public:
     using Ptr = std::shared_ptr<Action>;
@@ -36,9 +41,14 @@ public:
     clone() const
         = 0;
 
-    virtual void
-    execute(io::any_io_executor executor)
+    /* Runs the action returning the result of it */
+    [[nodiscard]] virtual io::awaitable<std::error_code>
+    run(io::any_io_executor executor)
         = 0;
+
+    /* Runs the action in the background signaling the result by completion callback */
+    void
+    execute(io::any_io_executor executor);
 };
 
 } // namespace jar
\ No newline at end of file
@@ -0,0 +1,48 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "intent/Action.hpp"
+#include "intent/HttpAction.hpp"
+#include "intent/MqttAction.hpp"
+#include "intent/PluginAction.hpp"
+#include "intent/ScriptAction.hpp"
+
+#include <jarvisto/network/Asio.hpp>
+
+#include <system_error>
+#include <variant>
+#include <vector>
+
+namespace jar {
+
+/**
+ * The definition of automation action built at config load. The definitions of automation are
+ * stored by value in contiguous array and run through visitation (the new type of action is
+ * added as the alternative of variant along with the overload of runner). The custom action
+ * (e.g. given at runtime) is run through its virtual interface.
+ */
+using ActionDef = std::variant<ScriptAction::Params,
+                               MqttAction::Params,
+                               PluginAction::Params,
+                               HttpAction::Params,
+                               Action::Ptr>;
+using ActionDefs = std::vector<ActionDef>;
+
+/* Runs the action of given definition (the definition must outlive the run) */
+[[nodiscard]] io::awaitable<std::error_code>
+runAction(const ActionDef& action, io::any_io_executor executor);
+
+} // namespace jar
\ No newline at end of file
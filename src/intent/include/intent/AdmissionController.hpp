@@ -0,0 +1,128 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace jar {
+
+/**
+ * The admission control of recognition sessions.
+ *
+ * The number of concurrent sessions is limited by fixed limit while the number of concurrent
+ * speech sessions is limited by adaptive limit. The adaptive limit follows the recognition
+ * latency (AIMD): it's increased additively while latency stays within the target and
+ * decreased multiplicatively otherwise.
+ */
+class AdmissionController : public std::enable_shared_from_this<AdmissionController> {
+public:
+    using Ptr = std::shared_ptr<AdmissionController>;
+    using Clock = std::chrono::steady_clock;
+
+    enum class Kind { Session, Speech };
+
+    struct Options {
+        /* The max number of concurrent sessions */
+        std::size_t maxSessions{1024};
+        /* The min value of concurrent speech sessions limit */
+        std::size_t minSpeechSessions{4};
+        /* The max value of concurrent speech sessions limit */
+        std::size_t maxSpeechSessions{256};
+        /* The target latency of speech recognition */
+        std::chrono::milliseconds targetLatency{2000};
+        /* The time client is asked to retry after being rejected */
+        std::chrono::seconds retryAfter{1};
+    };
+
+    /**
+     * The admission ticket (releases the admission upon being destroyed).
+     */
+    class Ticket {
+    public:
+        Ticket() = default;
+
+        Ticket(Ticket&& other) noexcept;
+
+        Ticket&
+        operator=(Ticket&& other) noexcept;
+
+        ~Ticket();
+
+        explicit
+        operator bool() const;
+
+        /* Reports the outcome of admitted work to adapt the limit */
+        void
+        complete(bool succeeded);
+
+        /* Reports the outcome of admitted work measuring latency since given time point */
+        void
+        complete(bool succeeded, Clock::time_point started);
+
+    private:
+        friend class AdmissionController;
+
+        Ticket(Ptr owner, Kind kind);
+
+        void
+        reset();
+
+    private:
+        Ptr _owner;
+        Kind _kind{Kind::Session};
+        Clock::time_point _started;
+    };
+
+    [[nodiscard]] static Ptr
+    create(Options options);
+
+    [[nodiscard]] const Options&
+    options() const;
+
+    /* Returns empty ticket if admission is rejected */
+    [[nodiscard]] Ticket
+    tryAdmit(Kind kind);
+
+    [[nodiscard]] std::size_t
+    sessions() const;
+
+    [[nodiscard]] std::size_t
+    speechSessions() const;
+
+    [[nodiscard]] double
+    speechLimit() const;
+
+    /* Adapts the speech sessions limit by the outcome of speech recognition */
+    void
+    update(Clock::duration latency, bool succeeded);
+
+private:
+    explicit AdmissionController(Options options);
+
+    void
+    release(Kind kind);
+
+private:
+    Options _options;
+    mutable std::mutex _guard;
+    std::size_t _sessions{};
+    std::size_t _speechSessions{};
+    double _speechLimit{};
+};
+
+} // namespace jar
\ No newline at end of file
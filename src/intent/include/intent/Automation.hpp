@@ -14,7 +14,7 @@
 
 #pragma once
 
-#include "intent/Action.hpp"
+#include "intent/ActionDef.hpp"
 #include "intent/DeferredJob.hpp"
 #include "intent/LaunchStrategy.hpp"
 
@@ -22,11 +22,17 @@
 
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <system_error>
 
 namespace jar {
 
+/**
+ * The automation running the actions upon recognized intent. The automation is immutable
+ * (except for completion callback of DeferredJob) so it's shared by concurrent runs instead
+ * of being cloned per run.
+ */
 class Automation final : public std::enable_shared_from_this<Automation>, public DeferredJob {
 public:
     using Ptr = std::shared_ptr<Automation>;
@@ -34,7 +40,7 @@ public:
     static Ptr
     create(std::string alias,
            std::string intent,
-           Action::List actions,
+           ActionDefs actions,
            LaunchStrategy::Ptr launchStrategy);
 
     [[nodiscard]] const std::string&
@@ -46,9 +52,14 @@ public:
     [[nodiscard]] const std::string&
     intent() const;
 
-    Ptr
-    clone();
+    [[nodiscard]] std::span<const ActionDef>
+    actions() const;
 
+    /* Runs the actions of automation returning the result of them */
+    [[nodiscard]] io::awaitable<std::error_code>
+    run(io::any_io_executor executor) const;
+
+    /* Runs the actions in the background signaling the result by completion callback */
     void
     execute(io::any_io_executor executor);
 
@@ -56,17 +67,14 @@ private:
     Automation(std::string id,
                std::string alias,
                std::string intent,
-               Action::List actions,
+               ActionDefs actions,
                LaunchStrategy::Ptr launchStrategy);
 
-    void
-    onExecuteDone(std::error_code ec);
-
 private:
     std::string _id;
     std::string _alias;
     std::string _intent;
-    Action::List _actions;
+    ActionDefs _actions;
     LaunchStrategy::Ptr _launcher;
 };
 
@@ -15,40 +15,85 @@
 #pragma once
 
 #include "common/Types.hpp"
+#include "intent/AutomationQueue.hpp"
 
 #include <jarvisto/network/Asio.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace jar {
 
 class Automation;
 class AutomationRegistry;
 
+/**
+ * The performer of automations given by recognition results. The results are handed off
+ * by sessions from many threads: the automations are executed concurrently (each on its own
+ * strand) and tracked by the running list sharded by the number of run.
+ *
+ * The automations are started through the queue limiting the number of them running at once
+ * (see AutomationQueue).
+ */
 class AutomationPerformer : public std::enable_shared_from_this<AutomationPerformer> {
 public:
     using Ptr = std::shared_ptr<AutomationPerformer>;
 
+    using Priority = AutomationQueue::Priority;
+
     static Ptr
-    create(io::any_io_executor executor, std::shared_ptr<AutomationRegistry> registry);
+    create(io::any_io_executor executor,
+           std::shared_ptr<AutomationRegistry> registry,
+           AutomationQueue::Options options = {});
 
     void
-    perform(const RecognitionResult& result);
+    perform(const RecognitionResult& result, Priority priority = Priority::Interactive);
+
+    /* Returns the number of automations waiting for execution */
+    [[nodiscard]] std::size_t
+    queued() const;
+
+    /* Returns the number of automations being executed at the moment */
+    [[nodiscard]] std::size_t
+    running() const;
 
 private:
-    explicit AutomationPerformer(io::any_io_executor executor,
-                                 std::shared_ptr<AutomationRegistry> registry);
+    AutomationPerformer(io::any_io_executor executor,
+                        std::shared_ptr<AutomationRegistry> registry,
+                        AutomationQueue::Options options);
 
 private:
+    /* Starts the queued automations allowed to run at the moment */
+    void
+    dispatch();
+
     void
-    onAutomationDone(const std::string& id, const std::string& alias, std::error_code ec);
+    doPerform(const std::string& intent);
+
+    void
+    onAutomationDone(std::uint64_t run,
+                     const std::shared_ptr<Automation>& automation,
+                     std::error_code ec);
+
+    struct alignas(64) Shard {
+        mutable std::mutex guard;
+        std::map<std::uint64_t, std::shared_ptr<Automation>> running;
+    };
+
+    [[nodiscard]] Shard&
+    shard(std::uint64_t run);
 
 private:
     io::any_io_executor _executor;
     std::shared_ptr<AutomationRegistry> _registry;
-    std::map<std::string, std::shared_ptr<Automation>> _runningList;
+    AutomationQueue _queue;
+    std::vector<Shard> _shards;
+    std::atomic<std::uint64_t> _nextRun{1};
 };
 
 } // namespace jar
\ No newline at end of file
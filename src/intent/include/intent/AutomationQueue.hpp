@@ -0,0 +1,109 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace jar {
+
+/**
+ * The queue of automations waiting for execution. The number of automations running at once
+ * is limited both globally and per automation (the automation is identified by its intent).
+ *
+ * The automations are started in the order of priority class and then in the order of
+ * enqueueing. The automation exceeding its own limit doesn't hold the others back.
+ */
+class AutomationQueue {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /* The priority class of automation (the former has precedence over the latter) */
+    enum class Priority { Interactive, Scheduled };
+
+    /* The way of handling the automation given upon full queue */
+    enum class Overflow {
+        /* Reject the given automation */
+        Reject,
+        /* Drop the oldest automation of the lowest priority class */
+        DropOldest
+    };
+
+    struct Options {
+        /* The max number of running automations (zero means no limit) */
+        std::size_t maxRunning{16};
+        /* The max number of running executions of the same automation (zero means no limit) */
+        std::size_t maxRunningPerAutomation{4};
+        /* The max number of waiting automations */
+        std::size_t capacity{256};
+        /* The way of handling the automation given upon full queue */
+        Overflow overflow{Overflow::Reject};
+    };
+
+    explicit AutomationQueue(Options options);
+
+    [[nodiscard]] const Options&
+    options() const;
+
+    /* Returns the number of waiting automations */
+    [[nodiscard]] std::size_t
+    queued() const;
+
+    /* Returns the number of running automations */
+    [[nodiscard]] std::size_t
+    running() const;
+
+    /* Enqueues the automation of given intent (returns false if it's rejected) */
+    bool
+    push(std::string intent, Priority priority, Clock::time_point now = Clock::now());
+
+    /* Takes the automations allowed to run at the moment (the running slots are taken) */
+    [[nodiscard]] std::vector<std::string>
+    pop(Clock::time_point now = Clock::now());
+
+    /* Releases the running slot of automation of given intent */
+    void
+    release(const std::string& intent);
+
+private:
+    struct Entry {
+        std::string intent;
+        Clock::time_point enqueued;
+    };
+
+    static constexpr std::size_t kPriorities{2};
+
+    [[nodiscard]] bool
+    canRun(const std::string& intent) const;
+
+    [[nodiscard]] bool
+    makeRoom(Priority priority);
+
+private:
+    Options _options;
+    mutable std::mutex _guard;
+    std::array<std::deque<Entry>, kPriorities> _queues;
+    std::unordered_map<std::string, std::size_t> _runningPerAutomation;
+    std::size_t _queued{};
+    std::size_t _running{};
+};
+
+} // namespace jar
\ No newline at end of file
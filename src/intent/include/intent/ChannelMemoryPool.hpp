@@ -0,0 +1,63 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+namespace jar {
+
+/**
+ * The memory pool shared by speech channels of all sessions.
+ *
+ * The blocks are reused between sessions instead of being allocated per session. The total
+ * amount of memory given out is limited by the budget (allocation beyond it throws bad_alloc).
+ */
+class ChannelMemoryPool final : public std::pmr::memory_resource {
+public:
+    using Ptr = std::shared_ptr<ChannelMemoryPool>;
+
+    /* Creates the pool with given budget (zero means no limit) */
+    [[nodiscard]] static Ptr
+    create(std::size_t budget);
+
+    [[nodiscard]] std::size_t
+    budget() const;
+
+    [[nodiscard]] std::size_t
+    used() const;
+
+private:
+    explicit ChannelMemoryPool(std::size_t budget);
+
+    void*
+    do_allocate(std::size_t bytes, std::size_t alignment) final;
+
+    void
+    do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) final;
+
+    [[nodiscard]] bool
+    do_is_equal(const std::pmr::memory_resource& other) const noexcept final;
+
+private:
+    std::size_t _budget;
+    mutable std::mutex _guard;
+    std::pmr::unsynchronized_pool_resource _pool;
+    std::size_t _used{};
+};
+
+} // namespace jar
\ No newline at end of file
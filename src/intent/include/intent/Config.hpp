@@ -16,6 +16,11 @@
 
 #include "common/ConfigLoader.hpp"
 #include "intent/Action.hpp"
+#include "intent/AdmissionController.hpp"
+#include "intent/AutomationQueue.hpp"
+#include "intent/HttpConnectionPool.hpp"
+#include "intent/RateLimiter.hpp"
+#include "intent/Types.hpp"
 
 #include <memory>
 #include <optional>
@@ -30,6 +35,10 @@ public:
     static constexpr uint32_t kDefaultServerPort{8080};
     /* Default server number of threads */
     static constexpr uint32_t kDefaultServerThreads{4};
+    /* Default number of threads of backend recognitions */
+    static constexpr uint32_t kDefaultBackendThreads{2};
+    /* Default number of threads of automation actions */
+    static constexpr uint32_t kDefaultAutomationThreads{1};
 
     explicit Config(std::shared_ptr<IAutomationRegistry> registry);
 
@@ -39,6 +48,31 @@ public:
     [[nodiscard]] uint32_t
     serverThreads() const;
 
+    [[nodiscard]] uint32_t
+    backendThreads() const;
+
+    [[nodiscard]] uint32_t
+    automationThreads() const;
+
+    [[nodiscard]] const SessionOptions&
+    sessionOptions() const;
+
+    [[nodiscard]] const RateLimiter::Options&
+    limiterOptions() const;
+
+    [[nodiscard]] const AdmissionController::Options&
+    admissionOptions() const;
+
+    [[nodiscard]] const AutomationQueue::Options&
+    automationQueueOptions() const;
+
+    [[nodiscard]] const HttpConnectionPool::Options&
+    httpPoolOptions() const;
+
+    /* Returns the pool of connections shared by HTTP actions (null if there is none) */
+    [[nodiscard]] std::shared_ptr<HttpConnectionPool>
+    httpPool() const;
+
     [[nodiscard]] std::optional<std::string>
     witRemoteHost() const;
 
@@ -58,6 +92,14 @@ private:
 private:
     uint32_t _serverPort{kDefaultServerPort};
     uint32_t _serverThreads{kDefaultServerThreads};
+    uint32_t _backendThreads{kDefaultBackendThreads};
+    uint32_t _automationThreads{kDefaultAutomationThreads};
+    SessionOptions _sessionOptions;
+    RateLimiter::Options _limiterOptions;
+    AdmissionController::Options _admissionOptions;
+    AutomationQueue::Options _automationQueueOptions;
+    HttpConnectionPool::Options _httpPoolOptions;
+    std::shared_ptr<HttpConnectionPool> _httpPool;
     std::optional<std::string> _witRemoteHost;
     std::optional<std::string> _witRemotePort;
     std::optional<std::string> _witRemoteAuth;
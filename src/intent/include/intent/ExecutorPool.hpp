@@ -0,0 +1,81 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <jarvisto/network/Asio.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace jar {
+
+class Histogram;
+
+/**
+ * The pool of threads running own io context. The service splits the work between separate
+ * pools (ingress, backend and automation) so the burst of work in one doesn't delay others.
+ *
+ * The queue latency of pool (the time the handler waits for free thread) is sampled
+ * periodically into <executor.NAME.queue_latency> histogram (in milliseconds).
+ */
+class ExecutorPool {
+public:
+    /* Default interval of sampling the queue latency */
+    static constexpr std::chrono::milliseconds kDefaultProbeInterval{1000};
+
+    ExecutorPool(std::string name,
+                 std::size_t threads,
+                 std::chrono::milliseconds probeInterval = kDefaultProbeInterval);
+
+    ~ExecutorPool();
+
+    ExecutorPool(const ExecutorPool&) = delete;
+    ExecutorPool&
+    operator=(const ExecutorPool&) = delete;
+
+    [[nodiscard]] const std::string&
+    name() const;
+
+    [[nodiscard]] std::size_t
+    threads() const;
+
+    [[nodiscard]] io::any_io_executor
+    executor();
+
+    void
+    start();
+
+    void
+    stop();
+
+private:
+    io::awaitable<void>
+    probe();
+
+private:
+    std::string _name;
+    std::size_t _threads;
+    std::chrono::milliseconds _probeInterval;
+    Histogram& _latency;
+    io::io_context _context;
+    std::optional<io::executor_work_guard<io::io_context::executor_type>> _guard;
+    std::vector<std::jthread> _workers;
+};
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,96 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <jarvisto/network/Asio.hpp>
+
+#include <boost/asio/buffer_registration.hpp>
+#include <boost/asio/registered_buffer.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace jar {
+
+/**
+ * The pool of fixed size buffers registered within the execution context. Using io_uring
+ * backend the kernel maps the registered buffers once instead of upon each read operation.
+ */
+class FixedBufferPool final : public std::enable_shared_from_this<FixedBufferPool> {
+public:
+    using Ptr = std::shared_ptr<FixedBufferPool>;
+
+    /* The buffer given out by pool and returned back upon destruction */
+    class Lease {
+    public:
+        Lease() = default;
+
+        Lease(Lease&& other) noexcept;
+
+        Lease&
+        operator=(Lease&& other) noexcept;
+
+        ~Lease();
+
+        [[nodiscard]] explicit
+        operator bool() const;
+
+        [[nodiscard]] io::mutable_registered_buffer
+        buffer() const;
+
+    private:
+        friend class FixedBufferPool;
+
+        Lease(std::shared_ptr<FixedBufferPool> pool, std::size_t index);
+
+    private:
+        std::shared_ptr<FixedBufferPool> _pool;
+        std::size_t _index{};
+    };
+
+    /* Creates the pool of given number of buffers registered within context of executor */
+    [[nodiscard]] static Ptr
+    create(const io::any_io_executor& executor, std::size_t count, std::size_t size);
+
+    [[nodiscard]] std::size_t
+    count() const;
+
+    [[nodiscard]] std::size_t
+    size() const;
+
+    /* Takes free buffer (the lease is empty if there is no free buffer) */
+    [[nodiscard]] Lease
+    acquire();
+
+private:
+    FixedBufferPool(const io::any_io_executor& executor, std::size_t count, std::size_t size);
+
+    void
+    release(std::size_t index);
+
+private:
+    using Registration = io::buffer_registration<std::vector<io::mutable_buffer>>;
+
+    std::size_t _size;
+    std::unique_ptr<std::byte[]> _memory;
+    std::optional<Registration> _registration;
+    std::mutex _guard;
+    std::vector<std::size_t> _free;
+};
+
+} // namespace jar
\ No newline at end of file
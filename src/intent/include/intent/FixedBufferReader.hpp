@@ -0,0 +1,57 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "intent/FixedBufferPool.hpp"
+#include "intent/RecognitionHandler.hpp"
+
+#include <cstddef>
+
+namespace jar {
+
+/**
+ * Reads the message into fixed (registered) buffer feeding the given parser. It's the
+ * counterpart of http::async_read() which reads into dynamic (not registered) buffer.
+ */
+class FixedBufferReader {
+public:
+    using Buffer = RecognitionHandler::Buffer;
+    using Parser = RecognitionHandler::Parser;
+
+    /* Takes over the data left in given buffer (it must fit the fixed buffer) */
+    FixedBufferReader(FixedBufferPool::Lease lease, Buffer& pending);
+
+    /* Returns true if the data left in given buffer fits the fixed buffer */
+    [[nodiscard]] static bool
+    canTakeOver(const FixedBufferPool::Lease& lease, const Buffer& pending);
+
+    /* Reads until the message is done or the parser fails (e.g. upon the end of chunk) */
+    io::awaitable<sys::error_code>
+    read(tcp::socket& socket, Parser& parser);
+
+private:
+    [[nodiscard]] std::byte*
+    data() const;
+
+    void
+    compact();
+
+private:
+    FixedBufferPool::Lease _lease;
+    std::size_t _begin{};
+    std::size_t _end{};
+};
+
+} // namespace jar
\ No newline at end of file
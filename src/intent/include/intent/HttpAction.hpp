@@ -0,0 +1,75 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "intent/Action.hpp"
+#include "intent/HttpConnectionPool.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace jar {
+
+/**
+ * The action sending HTTP request (e.g. calling webhook) over the keep-alive connection of
+ * given pool (see HttpConnectionPool). The response with other than 2xx status is a failure.
+ */
+class HttpAction final : public Action {
+public:
+    using Timeout = HttpConnectionPool::Timeout;
+    using Headers = std::vector<std::pair<std::string, std::string>>;
+
+    static inline const Timeout kDefaultConnectTimeout{5'000};
+    static inline const Timeout kDefaultTimeout{10'000};
+
+    /* The definition of action (see ActionDef) */
+    struct Params {
+        HttpConnectionPool::Endpoint endpoint;
+        http::verb method{http::verb::post};
+        std::string target{"/"};
+        Headers headers;
+        std::string body;
+        Timeout connectTimeout{kDefaultConnectTimeout};
+        Timeout timeout{kDefaultTimeout};
+        std::shared_ptr<HttpConnectionPool> pool;
+    };
+
+    [[nodiscard]] static Ptr
+    create(Params params);
+
+    [[nodiscard]] Ptr
+    clone() const final;
+
+    [[nodiscard]] io::awaitable<std::error_code>
+    run(io::any_io_executor executor) final;
+
+    /* Runs the action of given definition (the definition must outlive the run) */
+    [[nodiscard]] static io::awaitable<std::error_code>
+    run(const Params& params, io::any_io_executor executor);
+
+private:
+    explicit HttpAction(Params params);
+
+    static io::awaitable<std::error_code>
+    send(const Params& params, io::any_io_executor executor);
+
+private:
+    Params _params;
+};
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,124 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <jarvisto/network/Http.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace jar {
+
+/**
+ * The pool of keep-alive connections to HTTP servers (optionally secured by TLS). The idle
+ * connections are kept per host and reused by subsequent requests, the TLS session of host is
+ * kept to resume the handshake of new connection. Each connection runs on own strand.
+ *
+ * The pool is thread-safe. The reuse is recorded by <intent.http.pool_hits>,
+ * <intent.http.pool_misses> and <intent.http.tls_resumed> counters.
+ */
+class HttpConnectionPool {
+public:
+    using Timeout = std::chrono::milliseconds;
+    using Request = http::request<http::string_body>;
+    using Response = http::response<http::string_body>;
+
+    struct Options {
+        /* The max number of idle connections kept per host */
+        std::size_t maxIdlePerHost{4};
+        /* The max time the connection is kept idle */
+        Timeout idleTimeout{30'000};
+    };
+
+    struct Endpoint {
+        std::string host;
+        std::string port;
+        bool tls{false};
+        /* The certificate of server is verified (TLS only) */
+        bool verify{true};
+    };
+
+    explicit HttpConnectionPool(Options options);
+
+    ~HttpConnectionPool();
+
+    HttpConnectionPool(const HttpConnectionPool&) = delete;
+    HttpConnectionPool&
+    operator=(const HttpConnectionPool&) = delete;
+
+    [[nodiscard]] const Options&
+    options() const;
+
+    /* Returns the number of idle connections */
+    [[nodiscard]] std::size_t
+    idle() const;
+
+    /* Closes the idle connections (e.g. before the executor of connections is stopped) */
+    void
+    clear();
+
+    /**
+     * Sends the request over idle connection to given endpoint or over new connection created
+     * on given executor. The request sent over idle connection closed by server meanwhile is
+     * sent again over new connection. Throws system error upon failure.
+     */
+    io::awaitable<Response>
+    send(const Endpoint& endpoint,
+         Request request,
+         Timeout connectTimeout,
+         Timeout timeout,
+         io::any_io_executor executor);
+
+private:
+    class Connection;
+    using ConnectionPtr = std::unique_ptr<Connection>;
+
+    struct Idle {
+        ConnectionPtr connection;
+        std::chrono::steady_clock::time_point since;
+    };
+
+    [[nodiscard]] ConnectionPtr
+    acquire(const std::string& key);
+
+    void
+    release(const std::string& key, ConnectionPtr connection);
+
+    io::awaitable<ConnectionPtr>
+    connect(const Endpoint& endpoint,
+            const std::string& key,
+            Timeout timeout,
+            io::any_io_executor executor);
+
+    [[nodiscard]] std::shared_ptr<SSL_SESSION>
+    session(const std::string& key) const;
+
+    void
+    storeSession(const std::string& key, SSL* handle);
+
+private:
+    Options _options;
+    ssl::context _tls;
+    mutable std::mutex _guard;
+    std::map<std::string, std::vector<Idle>, std::less<>> _idle;
+    std::map<std::string, std::shared_ptr<SSL_SESSION>, std::less<>> _sessions;
+};
+
+} // namespace jar
\ No newline at end of file
@@ -14,16 +14,17 @@
 
 #pragma once
 
-#include "intent/Action.hpp"
-#include "intent/DeferredJob.hpp"
+#include "intent/ActionDef.hpp"
 
 #include <jarvisto/network/Asio.hpp>
 
 #include <memory>
+#include <span>
+#include <system_error>
 
 namespace jar {
 
-class LaunchStrategy : public DeferredJob {
+class LaunchStrategy {
 public:
     using Ptr = std::shared_ptr<LaunchStrategy>;
 
@@ -33,8 +34,9 @@ public:
     clone() const
         = 0;
 
-    virtual void
-    launch(io::any_io_executor executor, Action::List actions)
+    /* Runs given actions returning the result of them */
+    [[nodiscard]] virtual io::awaitable<std::error_code>
+    run(io::any_io_executor executor, std::span<const ActionDef> actions)
         = 0;
 };
 
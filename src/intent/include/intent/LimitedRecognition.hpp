@@ -0,0 +1,48 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "common/Recognition.hpp"
+#include "intent/RateLimiter.hpp"
+
+#include <functional>
+#include <memory>
+
+namespace jar {
+
+/**
+ * The recognition waiting for the rate limiter token before creating and running the wrapped
+ * recognition (the recognition rejected by limiter is never created).
+ */
+class LimitedRecognition final : public Recognition {
+public:
+    using Ptr = std::shared_ptr<LimitedRecognition>;
+    using Factory = std::function<std::shared_ptr<Recognition>()>;
+
+    static Ptr
+    create(Factory factory, std::shared_ptr<RateLimiter> limiter);
+
+    io::awaitable<RecognitionResult>
+    run() final;
+
+private:
+    LimitedRecognition(Factory factory, std::shared_ptr<RateLimiter> limiter);
+
+private:
+    Factory _factory;
+    std::shared_ptr<RateLimiter> _limiter;
+};
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,50 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "common/IRecognitionFactory.hpp"
+#include "intent/RateLimiter.hpp"
+
+#include <memory>
+#include <string>
+
+namespace jar {
+
+/**
+ * The recognition factory limiting the rate of recognitions created by given factory.
+ */
+class LimitedRecognitionFactory final : public IRecognitionFactory {
+public:
+    LimitedRecognitionFactory(std::shared_ptr<IRecognitionFactory> factory,
+                              std::shared_ptr<RateLimiter> limiter);
+
+    [[nodiscard]] bool
+    canRecognizeMessage() const final;
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    message(io::any_io_executor executor, std::string message) final;
+
+    [[nodiscard]] bool
+    canRecognizeSpeech() const final;
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    speech(io::any_io_executor executor, std::shared_ptr<DataChannel> channel) final;
+
+private:
+    std::shared_ptr<IRecognitionFactory> _factory;
+    std::shared_ptr<RateLimiter> _limiter;
+};
+
+} // namespace jar
\ No newline at end of file
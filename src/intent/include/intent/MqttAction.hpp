@@ -26,6 +26,16 @@ public:
     static inline uint16_t kDefaultPort = 1883;
     static inline int32_t kDefaultKeepAlive = 30;
 
+    /* The definition of action (see ActionDef) */
+    struct Params {
+        std::string topic;
+        std::string value;
+        std::string host;
+        uint16_t port{kDefaultPort};
+        std::optional<std::string> user;
+        std::optional<std::string> pass;
+    };
+
     [[nodiscard]] static std::shared_ptr<MqttAction>
     create(std::string topic, std::string value, std::string host, uint16_t port = kDefaultPort);
 
@@ -35,25 +45,21 @@ public:
     [[nodiscard]] std::shared_ptr<Action>
     clone() const final;
 
-    void
-    execute(io::any_io_executor executor) final;
+    [[nodiscard]] io::awaitable<std::error_code>
+    run(io::any_io_executor executor) final;
+
+    /* Runs the action of given definition (the definition must outlive the run) */
+    [[nodiscard]] static io::awaitable<std::error_code>
+    run(const Params& params, io::any_io_executor executor);
 
 private:
-    MqttAction(std::string topic,
-               std::string value,
-               std::string host,
-               uint16_t port = kDefaultPort);
+    explicit MqttAction(Params params);
 
-    io::awaitable<void>
-    send();
+    static io::awaitable<std::error_code>
+    send(const Params& params, io::any_io_executor executor);
 
 private:
-    std::string _topic;
-    std::string _value;
-    std::string _host;
-    uint16_t _port{kDefaultPort};
-    std::optional<std::string> _user;
-    std::optional<std::string> _pass;
+    Params _params;
 };
 
 } // namespace jar
\ No newline at end of file
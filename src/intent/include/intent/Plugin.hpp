@@ -0,0 +1,81 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "intent/PluginAbi.h"
+
+#include <jarvisto/network/Asio.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+
+namespace jar {
+
+class Counter;
+class Histogram;
+
+/**
+ * The plugin loaded from shared library (see PluginAbi.h). The plugin is loaded and initialized
+ * once at config load and shared by the actions using it. The state of plugin is released once
+ * the plugin is released and the last started execution is completed.
+ *
+ * The latency of completed executions is recorded into <intent.plugin.NAME.latency_ms>
+ * histogram, the failed and timed out executions are counted by <intent.plugin.NAME.failures>
+ * and <intent.plugin.NAME.timeouts> counters.
+ */
+class Plugin final : public std::enable_shared_from_this<Plugin> {
+public:
+    using Ptr = std::shared_ptr<Plugin>;
+    using Timeout = std::chrono::milliseconds;
+
+    [[nodiscard]] static Ptr
+    load(std::string name,
+         const std::filesystem::path& path,
+         const std::string& config,
+         std::error_code& ec);
+
+    ~Plugin();
+
+    Plugin(const Plugin&) = delete;
+    Plugin&
+    operator=(const Plugin&) = delete;
+
+    [[nodiscard]] const std::string&
+    name() const;
+
+    /* Runs the execution on the strand of awaiting coroutine, the execution is cancelled upon
+       timeout or cancellation of awaiting coroutine (its completion is not awaited then) */
+    [[nodiscard]] io::awaitable<std::error_code>
+    execute(Timeout timeout);
+
+private:
+    Plugin(std::string name, void* library);
+
+private:
+    std::string _name;
+    void* _library{};
+    void* _state{};
+    rintento_plugin_execute_fn _execute{};
+    rintento_plugin_cancel_fn _cancel{};
+    rintento_plugin_free_fn _free{};
+    Histogram& _latency;
+    Counter& _failures;
+    Counter& _timeouts;
+};
+
+} // namespace jar
\ No newline at end of file
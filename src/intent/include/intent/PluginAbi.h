@@ -0,0 +1,54 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/**
+ * The C ABI of plugin action. The plugin is the shared library exporting the functions below
+ * (the free function is optional). The plugin is loaded and initialized once at config load,
+ * then the execution is started on the automation executor and completed by calling given
+ * callback (from any thread, possibly before the execute function returns).
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RINTENTO_PLUGIN_ABI_VERSION 1
+
+/* Completes the execution with given error (0 upon success or errno value) */
+typedef void (*rintento_plugin_done_fn)(void* call, int error);
+
+/* Initializes the plugin of given ABI version and config, returns the state (NULL upon error) */
+typedef void* (*rintento_plugin_init_fn)(int abi, const char* config);
+
+/* Starts the execution identified by call handle, returns 0 if started (the done callback is
+   called exactly once then) or errno value otherwise (the done callback is not called) */
+typedef int (*rintento_plugin_execute_fn)(void* state, void* call, rintento_plugin_done_fn done);
+
+/* Requests cancellation of started execution (e.g. upon timeout), the execution is completed
+   as usual by the done callback. The cancellation of completed execution should be ignored. */
+typedef void (*rintento_plugin_cancel_fn)(void* state, void* call);
+
+/* Releases the state (no execution is running at the moment) */
+typedef void (*rintento_plugin_free_fn)(void* state);
+
+#define RINTENTO_PLUGIN_INIT "rintento_plugin_init"
+#define RINTENTO_PLUGIN_EXECUTE "rintento_plugin_execute"
+#define RINTENTO_PLUGIN_CANCEL "rintento_plugin_cancel"
+#define RINTENTO_PLUGIN_FREE "rintento_plugin_free"
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
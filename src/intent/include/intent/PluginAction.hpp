@@ -0,0 +1,61 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "intent/Action.hpp"
+#include "intent/Plugin.hpp"
+
+#include <chrono>
+#include <memory>
+
+namespace jar {
+
+/**
+ * The action running the execution of plugin in process (see Plugin). The execution is
+ * cancelled upon timeout or cancellation.
+ */
+class PluginAction final : public Action {
+public:
+    using Timeout = std::chrono::milliseconds;
+
+    static inline const Timeout kDefaultTimeout{5'000};
+
+    /* The definition of action (see ActionDef) */
+    struct Params {
+        Plugin::Ptr plugin;
+        Timeout timeout{kDefaultTimeout};
+    };
+
+    [[nodiscard]] static Ptr
+    create(Plugin::Ptr plugin, Timeout timeout = kDefaultTimeout);
+
+    [[nodiscard]] Ptr
+    clone() const final;
+
+    [[nodiscard]] io::awaitable<std::error_code>
+    run(io::any_io_executor executor) final;
+
+    /* Runs the action of given definition (the definition must outlive the run) */
+    [[nodiscard]] static io::awaitable<std::error_code>
+    run(const Params& params, io::any_io_executor executor);
+
+private:
+    explicit PluginAction(Params params);
+
+private:
+    Params _params;
+};
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,78 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <jarvisto/network/Asio.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+
+namespace jar {
+
+/**
+ * The asynchronous token bucket limiter of backend requests.
+ *
+ * The request exceeding the rate waits (being queued) for the token to be refilled. The request
+ * which can't get the token within max wait is rejected right away without waiting.
+ */
+class RateLimiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        /* The number of requests per second (zero means no limit) */
+        double rate{0.0};
+        /* The max number of requests in a burst */
+        double burst{10.0};
+        /* The max wait of request in a queue */
+        std::chrono::milliseconds maxWait{1000};
+    };
+
+    explicit RateLimiter(Options options);
+
+    [[nodiscard]] const Options&
+    options() const;
+
+    [[nodiscard]] bool
+    enabled() const;
+
+    /* Returns the number of requests waiting for the token */
+    [[nodiscard]] std::size_t
+    pending() const;
+
+    /* Waits for the token (returns false if token can't be given within max wait), the
+       waiting is cancelled using given slot (the token is returned upon cancel) */
+    [[nodiscard]] io::awaitable<bool>
+    acquire(io::cancellation_slot slot = {});
+
+    /* Reserves the token returning the time to wait for it */
+    [[nodiscard]] std::optional<Clock::duration>
+    reserve(Clock::time_point now = Clock::now());
+
+    /* Returns reserved but unused token */
+    void
+    refund();
+
+private:
+    Options _options;
+    mutable std::mutex _guard;
+    double _tokens{};
+    Clock::time_point _updated;
+    std::size_t _pending{};
+};
+
+} // namespace jar
\ No newline at end of file
@@ -19,8 +19,11 @@
 #include <jarvisto/network/Asio.hpp>
 #include <jarvisto/network/Http.hpp>
 
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <memory_resource>
+#include <string>
 
 namespace jar {
 
@@ -28,7 +31,9 @@ class RecognitionHandler {
 public:
     using Stream = beast::tcp_stream;
     using Buffer = beast::flat_buffer;
-    using Parser = http::request_parser<http::empty_body>;
+    /* The request header fields are allocated from the arena of session */
+    using Allocator = std::pmr::polymorphic_allocator<char>;
+    using Parser = http::request_parser<http::empty_body, Allocator>;
 
     explicit RecognitionHandler(Stream& stream);
 
@@ -40,13 +45,38 @@ public:
     virtual io::awaitable<RecognitionResult>
     handle();
 
+    /* Returns the first handler of the chain able to handle the request (or the last one) */
+    [[nodiscard]] RecognitionHandler&
+    select();
+
+    /* Drops the state of handled request making the chain ready for the next one */
+    virtual void
+    reset();
+
+    /* Returns the response telling the client to retry after given time */
+    [[nodiscard]] static http::response<http::string_body>
+    unavailableResponse(std::chrono::seconds retryAfter);
+
 protected:
+    [[nodiscard]] virtual bool
+    canHandle() const;
+
     io::awaitable<void>
     sendResponse(const RecognitionResult& result);
 
     io::awaitable<void>
     sendResponse(std::error_code ec);
 
+    io::awaitable<void>
+    sendPayload(std::string payload);
+
+    io::awaitable<void>
+    sendUnavailable(std::chrono::seconds retryAfter);
+
+    /* Sends the response telling the client the request exceeded the rate limit */
+    io::awaitable<void>
+    sendRateLimited();
+
     [[nodiscard]] Stream&
     stream();
 
@@ -14,7 +14,6 @@
 
 #pragma once
 
-#include "coro/BoundedChannel.hpp"
 #include "intent/RecognitionHandler.hpp"
 
 #include <memory>
@@ -29,12 +28,12 @@ class RecognitionMessageHandler final
       public std::enable_shared_from_this<RecognitionMessageHandler> {
 public:
     using Ptr = std::shared_ptr<RecognitionMessageHandler>;
-    using Channel = coro::BoundedChannel<char>;
 
     [[nodiscard]] static Ptr
     create(Stream& stream,
            Buffer& buffer,
            Parser& parser,
+           io::any_io_executor backend,
            std::shared_ptr<IRecognitionFactory> factory);
 
     io::awaitable<RecognitionResult>
@@ -44,17 +43,19 @@ private:
     RecognitionMessageHandler(Stream& stream,
                               Buffer& buffer,
                               Parser& parser,
+                              io::any_io_executor backend,
                               std::shared_ptr<IRecognitionFactory> factory);
 
     [[nodiscard]] bool
-    canHandle() const;
+    canHandle() const final;
 
-    io::awaitable<void>
-    sendMessageData(std::shared_ptr<Channel> channel);
+    [[nodiscard]] std::string
+    takeMessage();
 
 private:
     Buffer& _buffer;
     Parser& _parser;
+    io::any_io_executor _backend;
     std::shared_ptr<IRecognitionFactory> _factory;
 };
 
@@ -0,0 +1,48 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "intent/RecognitionHandler.hpp"
+
+#include <memory>
+
+namespace jar {
+
+/**
+ * Responds with the snapshot of service metrics in JSON format
+ */
+class RecognitionMetricsHandler final
+    : public RecognitionHandler,
+      public std::enable_shared_from_this<RecognitionMetricsHandler> {
+public:
+    using Ptr = std::shared_ptr<RecognitionMetricsHandler>;
+
+    [[nodiscard]] static Ptr
+    create(Stream& stream, Parser& parser);
+
+    io::awaitable<RecognitionResult>
+    handle() final;
+
+private:
+    RecognitionMetricsHandler(Stream& stream, Parser& parser);
+
+    [[nodiscard]] bool
+    canHandle() const final;
+
+private:
+    Parser& _parser;
+};
+
+} // namespace jar
\ No newline at end of file
@@ -14,9 +14,16 @@
 
 #pragma once
 
+#include "intent/AdmissionController.hpp"
+#include "intent/ChannelMemoryPool.hpp"
+#include "intent/FixedBufferPool.hpp"
+#include "intent/SessionPool.hpp"
+#include "intent/Types.hpp"
+
 #include <jarvisto/network/Asio.hpp>
 #include <jarvisto/network/Cancellable.hpp>
 
+#include <chrono>
 #include <memory>
 
 namespace jar {
@@ -28,29 +35,50 @@ class RecognitionServer : public std::enable_shared_from_this<RecognitionServer>
 public:
     using Ptr = std::shared_ptr<RecognitionServer>;
 
+    /* Creates the server accepting connections on given executor and running backend
+       recognitions on backend executor (the same executor if not given) */
     [[nodiscard]] static Ptr
     create(io::any_io_executor executor,
            std::shared_ptr<IRecognitionFactory> factory,
-           std::shared_ptr<AutomationPerformer> performer);
+           std::shared_ptr<AutomationPerformer> performer,
+           SessionOptions options = {},
+           AdmissionController::Options admission = {},
+           io::any_io_executor backend = {});
 
-    void
+    /* Starts listening on given endpoint and returns the endpoint the server is bound to
+       (e.g. the port chosen by system if zero port is given) */
+    tcp::endpoint
     listen(io::ip::port_type port);
 
-    void
+    tcp::endpoint
     listen(const tcp::endpoint& endpoint);
 
 private:
     RecognitionServer(io::any_io_executor executor,
                       std::shared_ptr<IRecognitionFactory> factory,
-                      std::shared_ptr<AutomationPerformer> performer);
+                      std::shared_ptr<AutomationPerformer> performer,
+                      SessionOptions options,
+                      AdmissionController::Options admission,
+                      io::any_io_executor backend);
 
     io::awaitable<void>
-    doListen(tcp::endpoint endpoint);
+    doListen(tcp::acceptor acceptor);
+
+    /* Rejects the connection by service unavailable response (it doesn't refer to the server
+       which might be gone before the response is sent) */
+    static io::awaitable<void>
+    doReject(tcp::socket socket, std::chrono::seconds retryAfter);
 
 private:
     io::any_io_executor _executor;
+    io::any_io_executor _backend;
     std::shared_ptr<IRecognitionFactory> _factory;
     std::shared_ptr<AutomationPerformer> _performer;
+    SessionOptions _options;
+    AdmissionController::Ptr _admission;
+    ChannelMemoryPool::Ptr _memory;
+    FixedBufferPool::Ptr _buffers;
+    SessionPool::Ptr _sessions;
 };
 
 } // namespace jar
\ No newline at end of file
@@ -14,52 +14,103 @@
 
 #pragma once
 
+#include "intent/AdmissionController.hpp"
+#include "intent/ChannelMemoryPool.hpp"
+#include "intent/FixedBufferPool.hpp"
+#include "intent/RecognitionHandler.hpp"
+#include "intent/Types.hpp"
+
 #include <jarvisto/network/Asio.hpp>
 #include <jarvisto/network/Http.hpp>
 
+#include <array>
+#include <functional>
 #include <memory>
+#include <memory_resource>
 
 namespace jar {
 
 class IRecognitionFactory;
-class RecognitionHandler;
 class AutomationPerformer;
 
+/**
+ * The session serving the connection of client. The session is reusable: upon completion
+ * it's reset (keeping the capacity of buffers and the chain of handlers) and handed over
+ * to the recycler to serve the next connection.
+ *
+ * The request scoped data (e.g. header fields) is allocated from the arena of session
+ * which is released in one shot upon completion.
+ *
+ * The connection is served on the strand of session (kept across reuse) so the session
+ * is free of data races while running on multi-threaded executor.
+ */
 class RecognitionSession : public std::enable_shared_from_this<RecognitionSession> {
 public:
     using Ptr = std::shared_ptr<RecognitionSession>;
+    using Recycler = std::function<void(Ptr)>;
 
     [[nodiscard]] static Ptr
-    create(std::size_t id,
-           tcp::socket&& socket,
+    create(io::any_io_executor executor,
+           io::any_io_executor backend,
            std::shared_ptr<IRecognitionFactory> factory,
-           std::shared_ptr<AutomationPerformer> performer);
+           std::shared_ptr<AutomationPerformer> performer,
+           std::shared_ptr<AdmissionController> admission,
+           std::shared_ptr<ChannelMemoryPool> memory,
+           std::shared_ptr<FixedBufferPool> buffers,
+           SessionOptions options = {},
+           Recycler recycler = {});
 
     [[nodiscard]] std::size_t
     id() const;
 
+    /* Returns the strand of session (the connection is expected to be accepted on it) */
+    [[nodiscard]] io::any_io_executor
+    executor();
+
     void
-    run();
+    run(std::size_t id, tcp::socket&& socket, AdmissionController::Ticket ticket);
 
 private:
-    RecognitionSession(std::size_t id,
-                       tcp::socket&& socket,
+    RecognitionSession(io::any_io_executor executor,
+                       io::any_io_executor backend,
                        std::shared_ptr<IRecognitionFactory> factory,
-                       std::shared_ptr<AutomationPerformer> performer);
+                       std::shared_ptr<AutomationPerformer> performer,
+                       std::shared_ptr<AdmissionController> admission,
+                       std::shared_ptr<ChannelMemoryPool> memory,
+                       std::shared_ptr<FixedBufferPool> buffers,
+                       SessionOptions options,
+                       Recycler recycler);
 
     io::awaitable<void>
     doRun();
 
     std::shared_ptr<RecognitionHandler>
-    getHandler();
+    createHandler();
+
+    /* Resets the state of served connection and hands the session over to recycler */
+    void
+    recycle();
 
 private:
-    std::size_t _id;
+    /* The size of initial arena buffer enough to hold the typical request */
+    static constexpr std::size_t kArenaSize{4096};
+
+    std::size_t _id{};
     beast::tcp_stream _stream;
     beast::flat_buffer _buffer;
-    http::request_parser<http::empty_body> _parser;
+    alignas(std::max_align_t) std::array<std::byte, kArenaSize> _arenaBuffer;
+    std::pmr::monotonic_buffer_resource _arena;
+    RecognitionHandler::Parser _parser;
+    io::any_io_executor _backend;
     std::shared_ptr<IRecognitionFactory> _factory;
     std::shared_ptr<AutomationPerformer> _performer;
+    std::shared_ptr<AdmissionController> _admission;
+    std::shared_ptr<ChannelMemoryPool> _memory;
+    std::shared_ptr<FixedBufferPool> _buffers;
+    AdmissionController::Ticket _ticket;
+    SessionOptions _options;
+    Recycler _recycler;
+    std::shared_ptr<RecognitionHandler> _handler;
 };
 
 } // namespace jar
\ No newline at end of file
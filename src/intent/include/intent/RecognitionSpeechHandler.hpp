@@ -15,13 +15,23 @@
 #pragma once
 
 #include "coro/BoundedChannel.hpp"
+#include "intent/AdmissionController.hpp"
+#include "intent/ChannelMemoryPool.hpp"
+#include "intent/FixedBufferPool.hpp"
 #include "intent/RecognitionHandler.hpp"
+#include "intent/SpeechDataBuffer.hpp"
+#include "intent/Types.hpp"
 
 #include <memory>
 
 namespace jar {
 
+namespace audio {
+class Decoder;
+} // namespace audio
+
 class IRecognitionFactory;
+class Recognition;
 
 class RecognitionSpeechHandler final
     : public RecognitionHandler,
@@ -34,27 +44,96 @@ public:
     create(Stream& stream,
            Buffer& buffer,
            Parser& parser,
-           std::shared_ptr<IRecognitionFactory> factory);
+           io::any_io_executor backend,
+           std::shared_ptr<IRecognitionFactory> factory,
+           std::shared_ptr<AdmissionController> admission,
+           std::shared_ptr<ChannelMemoryPool> memory,
+           std::shared_ptr<FixedBufferPool> buffers = {},
+           SessionOptions options = {});
 
     io::awaitable<RecognitionResult>
     handle() final;
 
+    void
+    reset() final;
+
 private:
     RecognitionSpeechHandler(Stream& stream,
                              Buffer& buffer,
                              Parser& parser,
-                             std::shared_ptr<IRecognitionFactory> factory);
+                             io::any_io_executor backend,
+                             std::shared_ptr<IRecognitionFactory> factory,
+                             std::shared_ptr<AdmissionController> admission,
+                             std::shared_ptr<ChannelMemoryPool> memory,
+                             std::shared_ptr<FixedBufferPool> buffers,
+                             SessionOptions options);
 
     [[nodiscard]] bool
-    canHandle() const;
+    canHandle() const final;
+
+    [[nodiscard]] std::unique_ptr<audio::Decoder>
+    createDecoder() const;
+
+    io::awaitable<void>
+    sendSpeechData(std::unique_ptr<audio::Decoder> decoder);
+
+    io::awaitable<void>
+    readSpeechData(std::unique_ptr<audio::Decoder> decoder);
+
+    io::awaitable<void>
+    sendSpeechChunk(std::string_view data);
 
     io::awaitable<void>
-    sendSpeechData(std::shared_ptr<Channel> channel);
+    sendSpeechEnd();
+
+    io::awaitable<RecognitionResult>
+    recognize(std::shared_ptr<Recognition> recognition);
+
+    io::awaitable<void>
+    replaySpeechData(std::shared_ptr<Channel> channel);
+
+    io::awaitable<RecognitionResult>
+    runRecognition(std::shared_ptr<Recognition> recognition);
+
+    [[nodiscard]] std::shared_ptr<Channel>
+    createChannel(const io::any_io_executor& executor) const;
+
+    /* The channel is used only on the executor of backend recognition (data is handed off) */
+    static io::awaitable<Channel::Result>
+    sendToChannel(std::shared_ptr<Channel> channel, io::const_buffer data);
+
+    static io::awaitable<void>
+    sendToChannel(std::shared_ptr<Channel> channel, sys::error_code status);
+
+    static void
+    closeChannel(std::shared_ptr<Channel> channel);
+
+    /* Records the usage of speech channel memory */
+    static void
+    observeChannel(std::shared_ptr<Channel> channel);
+
+    /* Tears down the backend recognition (e.g. upon client disconnect) */
+    void
+    cancelRecognition();
+
+    [[nodiscard]] bool
+    canRetry(const sys::error_code& ec, std::size_t attempt) const;
 
 private:
     Buffer& _buffer;
     Parser& _parser;
+    io::any_io_executor _backend;
     std::shared_ptr<IRecognitionFactory> _factory;
+    std::shared_ptr<AdmissionController> _admission;
+    std::shared_ptr<ChannelMemoryPool> _memory;
+    std::shared_ptr<FixedBufferPool> _buffers;
+    SessionOptions _options;
+    SpeechDataBuffer _capture;
+    io::any_io_executor _strand;
+    std::shared_ptr<Channel> _channel;
+    std::shared_ptr<Recognition> _recognition;
+    AdmissionController::Clock::time_point _speechEnded;
+    bool _replaying{false};
 };
 
 } // namespace jar
\ No newline at end of file
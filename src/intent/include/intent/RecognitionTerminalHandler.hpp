@@ -32,6 +32,9 @@ public:
 
 private:
     explicit RecognitionTerminalHandler(Stream& stream);
+
+    [[nodiscard]] bool
+    canHandle() const final;
 };
 
 } // namespace jar
\ No newline at end of file
@@ -21,12 +21,20 @@
 #include <chrono>
 #include <filesystem>
 #include <memory>
+#include <optional>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace jar {
 
-class ScriptAction final : public std::enable_shared_from_this<ScriptAction>, public Action {
+class ScriptLauncher;
+
+/**
+ * The action running the program. The program is terminated upon timeout or cancellation.
+ * The program is spawned by installed launcher process if any (see ScriptLauncher).
+ */
+class ScriptAction final : public Action {
 public:
     using Args = std::vector<std::string>;
     using Environment = std::unordered_map<std::string, std::string>;
@@ -34,6 +42,27 @@ public:
 
     static inline const Timeout kDefaultTimeout{15'000};
 
+    /* The resolved definition of action shared by all runs (see compile()) */
+    struct Plan {
+        std::filesystem::path exec;
+        std::filesystem::path home;
+        /* The list of <NAME=VALUE> entries (the environment of service is used if not given) */
+        std::optional<std::vector<std::string>> env;
+        /* The command encoded for launcher process */
+        std::string request;
+    };
+
+    /* The definition of action (see ActionDef) */
+    struct Params {
+        std::filesystem::path exec;
+        Args args;
+        std::filesystem::path home;
+        Environment env;
+        bool inheritParentEnv{false};
+        Timeout timeout{kDefaultTimeout};
+        std::shared_ptr<const Plan> plan;
+    };
+
     [[nodiscard]] static Ptr
     create(std::filesystem::path exec,
            Args args = {},
@@ -45,39 +74,37 @@ public:
     [[nodiscard]] Ptr
     clone() const final;
 
-    void
-    execute(io::any_io_executor executor) final;
+    [[nodiscard]] io::awaitable<std::error_code>
+    run(io::any_io_executor executor) final;
 
-private:
-    explicit ScriptAction(std::filesystem::path exec,
-                          Args args = {},
-                          std::filesystem::path home = {},
-                          Environment env = {},
-                          bool inheritParentEnv = false,
-                          Timeout timeout = kDefaultTimeout);
+    /* Resolves the executable, home directory and environment of definition once (e.g. at
+       config load), the definition is resolved upon each run otherwise */
+    [[nodiscard]] static std::error_code
+    compile(Params& params);
 
-    void
-    run();
+    /* Runs the action of given definition (the definition must outlive the run) */
+    [[nodiscard]] static io::awaitable<std::error_code>
+    run(const Params& params, io::any_io_executor executor);
+
+private:
+    explicit ScriptAction(Params params);
 
-    void
-    terminate();
+    [[nodiscard]] static std::shared_ptr<const Plan>
+    makePlan(const Params& params, std::error_code& ec);
 
-    void
-    scheduleTimer();
+    static io::awaitable<std::error_code>
+    spawn(const Params& params,
+          std::shared_ptr<const Plan> plan,
+          std::shared_ptr<ScriptLauncher> launcher,
+          io::any_io_executor executor);
 
-    void
-    cancelTimer();
+    static io::awaitable<std::error_code>
+    execute(const Params& params,
+            std::shared_ptr<const Plan> plan,
+            io::any_io_executor executor);
 
 private:
-    io::any_io_executor _executor;
-    std::filesystem::path _exec;
-    Args _args;
-    std::filesystem::path _home;
-    Environment _env;
-    bool _inheritParentEnv{false};
-    Timeout _timeout{kDefaultTimeout};
-    io::cancellation_signal _runningSig;
-    std::unique_ptr<io::steady_timer> _runningTimer;
+    Params _params;
 };
 
 } // namespace jar
\ No newline at end of file
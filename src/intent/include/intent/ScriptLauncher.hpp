@@ -0,0 +1,108 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <jarvisto/network/Asio.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace jar {
+
+/**
+ * The launcher of programs through the helper process (zygote). The helper is forked at startup
+ * while the service is still small and single-threaded, then it spawns the programs upon request
+ * (using posix_spawn) and reports their exit status. The request is sent over Unix socket along
+ * with the socket the status is reported to. The program is killed once the requester closes
+ * its socket (e.g. upon timeout or cancellation).
+ */
+class ScriptLauncher {
+public:
+    using Ptr = std::shared_ptr<ScriptLauncher>;
+    using Args = std::vector<std::string>;
+    /* The list of <NAME=VALUE> entries */
+    using Environment = std::vector<std::string>;
+
+    /* The max size of encoded command */
+    static constexpr std::size_t kMaxCommandSize{64 * 1024};
+
+    struct Command {
+        /* The executable is looked up in PATH unless it contains slash */
+        std::filesystem::path exec;
+        Args args;
+        std::filesystem::path home;
+        /* The environment of launcher is inherited if not given */
+        std::optional<Environment> env;
+    };
+
+    /* Forks the helper process (must be called before any thread is started) */
+    [[nodiscard]] static Ptr
+    create();
+
+    /* Sets the launcher used by script actions (once at startup) */
+    static void
+    install(Ptr launcher);
+
+    [[nodiscard]] static Ptr
+    installed();
+
+    ~ScriptLauncher();
+
+    ScriptLauncher(const ScriptLauncher&) = delete;
+    ScriptLauncher&
+    operator=(const ScriptLauncher&) = delete;
+
+    [[nodiscard]] pid_t
+    pid() const;
+
+    /* Tells whether the launcher takes requests (it's gone once sending to it is broken) */
+    [[nodiscard]] bool
+    alive() const;
+
+    /* Encodes the command once to launch it many times (empty upon too long command) */
+    [[nodiscard]] static std::string
+    encode(const Command& command);
+
+    /* Runs the program and returns its exit code (or 128 + number of terminating signal) */
+    [[nodiscard]] io::awaitable<std::tuple<std::error_code, int>>
+    launch(const Command& command, io::any_io_executor executor);
+
+    /* Runs the program of encoded command (the command must outlive the launch) */
+    [[nodiscard]] io::awaitable<std::tuple<std::error_code, int>>
+    launch(std::string_view request, io::any_io_executor executor);
+
+private:
+    ScriptLauncher(pid_t pid, int control);
+
+    /* Sends the request without blocking the thread (waits while the launcher is busy) */
+    io::awaitable<std::error_code>
+    send(std::string_view request, int reply, io::any_io_executor executor);
+
+private:
+    pid_t _pid;
+    int _control;
+    std::atomic<bool> _alive{true};
+};
+
+} // namespace jar
\ No newline at end of file
@@ -22,38 +22,18 @@
 
 namespace jar {
 
-class SequentLaunchStrategy final : public std::enable_shared_from_this<SequentLaunchStrategy>,
-                                    public LaunchStrategy {
+/**
+ * The strategy running the actions one by one (stops upon the first failed action).
+ */
+class SequentLaunchStrategy final : public LaunchStrategy {
 public:
     SequentLaunchStrategy() = default;
 
     [[nodiscard]] Ptr
     clone() const final;
 
-    void
-    launch(io::any_io_executor executor, Action::List actions) final;
-
-private:
-    [[nodiscard]] Action::Ptr
-    currentAction() const;
-
-    std::size_t
-    currentActionIndex() const;
-
-    [[nodiscard]] bool
-    hasNextAction() const;
-
-    void
-    executeNextAction();
-
-    void
-    onActionDone(std::error_code ec);
-
-private:
-    io::any_io_executor _executor;
-    std::size_t _currIndex{};
-    std::size_t _nextIndex{};
-    Action::List _actions;
+    [[nodiscard]] io::awaitable<std::error_code>
+    run(io::any_io_executor executor, std::span<const ActionDef> actions) final;
 };
 
 } // namespace jar
\ No newline at end of file
@@ -0,0 +1,70 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "intent/RecognitionSession.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace jar {
+
+/**
+ * The pool of reusable sessions. The idle sessions are kept per thread (the pool is split
+ * into shards assigned to threads) so acquiring and releasing sessions doesn't contend.
+ */
+class SessionPool final : public std::enable_shared_from_this<SessionPool> {
+public:
+    using Ptr = std::shared_ptr<SessionPool>;
+    using Factory = std::function<RecognitionSession::Ptr(RecognitionSession::Recycler)>;
+
+    /* Creates the pool keeping up to given number of idle sessions per thread */
+    [[nodiscard]] static Ptr
+    create(std::size_t capacity, Factory factory);
+
+    [[nodiscard]] std::size_t
+    capacity() const;
+
+    /* Returns the number of idle sessions of all threads */
+    [[nodiscard]] std::size_t
+    idle() const;
+
+    /* Takes idle session of calling thread or creates new one */
+    [[nodiscard]] RecognitionSession::Ptr
+    acquire();
+
+    void
+    release(RecognitionSession::Ptr session);
+
+private:
+    SessionPool(std::size_t capacity, Factory factory);
+
+    struct alignas(64) Shard {
+        mutable std::mutex guard;
+        std::vector<RecognitionSession::Ptr> sessions;
+    };
+
+    [[nodiscard]] Shard&
+    shard();
+
+private:
+    std::size_t _capacity;
+    Factory _factory;
+    std::vector<Shard> _shards;
+};
+
+} // namespace jar
\ No newline at end of file
@@ -14,15 +14,19 @@
 
 #pragma once
 
-#include <jarvisto/network/Asio.hpp>
-
 #include <boost/circular_buffer.hpp>
 
-#include <atomic>
 #include <mutex>
+#include <string>
+#include <string_view>
 
 namespace jar {
 
+/**
+ * Per session capture of speech data used to replay the speech from the very beginning.
+ * The memory is allocated on demand up to given capacity. Upon overflow the captured data
+ * is released and the capture is marked as overflowed (replaying is not possible anymore).
+ */
 class SpeechDataBuffer {
 public:
     explicit SpeechDataBuffer(std::size_t capacity);
@@ -33,11 +37,12 @@ public:
     [[nodiscard]] bool
     completed() const;
 
-    [[nodiscard]] std::size_t
-    size() const;
+    [[nodiscard]] bool
+    overflowed() const;
 
+    /* Return total number of written bytes */
     [[nodiscard]] std::size_t
-    available() const;
+    size() const;
 
     [[nodiscard]] std::size_t
     capacity() const;
@@ -45,17 +50,24 @@ public:
     void
     write(std::string_view data);
 
-    [[nodiscard]] io::const_buffer
-    extract();
+    /* Appends up to given number of captured bytes starting from given offset to the output */
+    std::size_t
+    read(std::size_t offset, std::string& output, std::size_t size) const;
 
     void
     complete();
 
+    /* Drops captured data making the buffer ready for the next speech */
+    void
+    reset();
+
 private:
-    std::atomic<long> _offset;
-    std::atomic<bool> _completed;
+    const std::size_t _capacity;
     mutable std::mutex _guard;
-    boost::circular_buffer<char> _buffer;
+    std::size_t _written{};
+    bool _completed{};
+    bool _overflowed{};
+    boost::circular_buffer_space_optimized<char> _buffer;
 };
 
 } // namespace jar
\ No newline at end of file
@@ -0,0 +1,49 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+
+namespace jar {
+
+/**
+ * The options of recognition session
+ */
+struct SessionOptions {
+    /* Default max size of captured speech data (30 seconds of speech in native format) */
+    static constexpr std::size_t kDefaultSpeechCaptureSize{30 * 16000 * 2};
+    /* Default max number of speech recognition retries */
+    static constexpr std::size_t kDefaultSpeechRetries{1};
+    /* Default max size of speech channel between client and backend connections */
+    static constexpr std::size_t kDefaultSpeechChannelCapacity{1'000'000};
+    /* Default max size of memory of all speech channels */
+    static constexpr std::size_t kDefaultSpeechChannelBudget{64 * 1024 * 1024};
+    /* Default number of fixed buffers registered for reading speech data (zero disables) */
+    static constexpr std::size_t kDefaultSpeechFixedBuffers{0};
+    /* Default size of fixed buffer registered for reading speech data */
+    static constexpr std::size_t kDefaultSpeechFixedBufferSize{16 * 1024};
+    /* Default max number of idle sessions kept for reuse per thread */
+    static constexpr std::size_t kDefaultSessionPoolSize{64};
+
+    std::size_t speechCaptureSize{kDefaultSpeechCaptureSize};
+    std::size_t speechRetries{kDefaultSpeechRetries};
+    std::size_t speechChannelCapacity{kDefaultSpeechChannelCapacity};
+    std::size_t speechChannelBudget{kDefaultSpeechChannelBudget};
+    std::size_t speechFixedBuffers{kDefaultSpeechFixedBuffers};
+    std::size_t speechFixedBufferSize{kDefaultSpeechFixedBufferSize};
+    std::size_t sessionPoolSize{kDefaultSessionPoolSize};
+};
+
+} // namespace jar
\ No newline at end of file
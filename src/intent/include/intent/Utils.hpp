@@ -31,6 +31,9 @@ isMessageTarget(std::string_view input);
 [[nodiscard]] bool
 isSpeechTarget(std::string_view input);
 
+[[nodiscard]] bool
+isMetricsTarget(std::string_view input);
+
 } // namespace parser
 
 } // namespace jar
\ No newline at end of file
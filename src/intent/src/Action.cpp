@@ -0,0 +1,46 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/Action.hpp"
+
+#include "common/Logging.hpp"
+
+#include <exception>
+
+namespace jar {
+
+void
+Action::execute(io::any_io_executor executor)
+{
+    io::co_spawn(
+        executor, run(executor), [this](const std::exception_ptr& eptr, std::error_code ec) {
+            try {
+                if (eptr) {
+                    std::rethrow_exception(eptr);
+                }
+            } catch (const sys::system_error& e) {
+                LOGE("Exception was occurred: {}", e.what());
+                ec = e.code();
+            } catch (const std::system_error& e) {
+                LOGE("Exception was occurred: {}", e.what());
+                ec = e.code();
+            } catch (const std::exception& e) {
+                LOGE("Exception was occurred: {}", e.what());
+                ec = std::make_error_code(std::errc::operation_canceled);
+            }
+            complete(ec);
+        });
+}
+
+} // namespace jar
\ No newline at end of file
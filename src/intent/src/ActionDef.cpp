@@ -0,0 +1,66 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/ActionDef.hpp"
+
+#include <boost/assert.hpp>
+
+namespace jar {
+
+namespace {
+
+struct ActionRunner {
+    io::any_io_executor executor;
+
+    io::awaitable<std::error_code>
+    operator()(const ScriptAction::Params& params) const
+    {
+        return ScriptAction::run(params, executor);
+    }
+
+    io::awaitable<std::error_code>
+    operator()(const MqttAction::Params& params) const
+    {
+        return MqttAction::run(params, executor);
+    }
+
+    io::awaitable<std::error_code>
+    operator()(const PluginAction::Params& params) const
+    {
+        return PluginAction::run(params, executor);
+    }
+
+    io::awaitable<std::error_code>
+    operator()(const HttpAction::Params& params) const
+    {
+        return HttpAction::run(params, executor);
+    }
+
+    io::awaitable<std::error_code>
+    operator()(const Action::Ptr& action) const
+    {
+        BOOST_ASSERT(action);
+        return action->run(executor);
+    }
+};
+
+} // namespace
+
+io::awaitable<std::error_code>
+runAction(const ActionDef& action, io::any_io_executor executor)
+{
+    return std::visit(ActionRunner{std::move(executor)}, action);
+}
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,204 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/AdmissionController.hpp"
+
+#include "common/Metrics.hpp"
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+
+namespace jar {
+
+namespace {
+
+/* The factor of limit decrease upon overload */
+constexpr double kBackoffRatio{0.9};
+
+struct AdmissionMetrics {
+    Gauge& sessions{Metrics::instance().gauge("intent.admission.sessions")};
+    Gauge& speechSessions{Metrics::instance().gauge("intent.admission.speech_sessions")};
+    Gauge& speechLimit{Metrics::instance().gauge("intent.admission.speech_limit")};
+    Counter& rejected{Metrics::instance().counter("intent.admission.rejected")};
+};
+
+AdmissionMetrics&
+metrics()
+{
+    static AdmissionMetrics instance;
+    return instance;
+}
+
+} // namespace
+
+AdmissionController::Ticket::Ticket(Ptr owner, Kind kind)
+    : _owner{std::move(owner)}
+    , _kind{kind}
+    , _started{Clock::now()}
+{
+}
+
+AdmissionController::Ticket::Ticket(Ticket&& other) noexcept
+    : _owner{std::move(other._owner)}
+    , _kind{other._kind}
+    , _started{other._started}
+{
+}
+
+AdmissionController::Ticket&
+AdmissionController::Ticket::operator=(Ticket&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        _owner = std::move(other._owner);
+        _kind = other._kind;
+        _started = other._started;
+    }
+    return *this;
+}
+
+AdmissionController::Ticket::~Ticket()
+{
+    reset();
+}
+
+AdmissionController::Ticket::operator bool() const
+{
+    return static_cast<bool>(_owner);
+}
+
+void
+AdmissionController::Ticket::complete(bool succeeded)
+{
+    complete(succeeded, _started);
+}
+
+void
+AdmissionController::Ticket::complete(bool succeeded, Clock::time_point started)
+{
+    if (_owner) {
+        _owner->update(Clock::now() - std::max(started, _started), succeeded);
+        reset();
+    }
+}
+
+void
+AdmissionController::Ticket::reset()
+{
+    if (_owner) {
+        _owner->release(_kind);
+        _owner.reset();
+    }
+}
+
+AdmissionController::Ptr
+AdmissionController::create(Options options)
+{
+    return Ptr(new AdmissionController(options));
+}
+
+AdmissionController::AdmissionController(Options options)
+    : _options{options}
+    , _speechLimit{static_cast<double>(options.maxSpeechSessions)}
+{
+    BOOST_ASSERT(_options.maxSessions > 0);
+    BOOST_ASSERT(_options.minSpeechSessions > 0);
+    BOOST_ASSERT(_options.minSpeechSessions <= _options.maxSpeechSessions);
+    metrics().speechLimit.set(static_cast<std::int64_t>(_speechLimit));
+}
+
+const AdmissionController::Options&
+AdmissionController::options() const
+{
+    return _options;
+}
+
+AdmissionController::Ticket
+AdmissionController::tryAdmit(Kind kind)
+{
+    {
+        std::lock_guard lock{_guard};
+        if (kind == Kind::Session) {
+            if (_sessions < _options.maxSessions) {
+                _sessions++;
+                metrics().sessions.increment();
+                return Ticket{shared_from_this(), kind};
+            }
+        } else {
+            if (static_cast<double>(_speechSessions) < _speechLimit) {
+                _speechSessions++;
+                metrics().speechSessions.increment();
+                return Ticket{shared_from_this(), kind};
+            }
+        }
+    }
+    LOGW("Reject {} admission due to overload", (kind == Kind::Session) ? "session" : "speech");
+    metrics().rejected.increment();
+    return Ticket{};
+}
+
+std::size_t
+AdmissionController::sessions() const
+{
+    std::lock_guard lock{_guard};
+    return _sessions;
+}
+
+std::size_t
+AdmissionController::speechSessions() const
+{
+    std::lock_guard lock{_guard};
+    return _speechSessions;
+}
+
+double
+AdmissionController::speechLimit() const
+{
+    std::lock_guard lock{_guard};
+    return _speechLimit;
+}
+
+void
+AdmissionController::update(Clock::duration latency, bool succeeded)
+{
+    std::lock_guard lock{_guard};
+    const auto minLimit = static_cast<double>(_options.minSpeechSessions);
+    const auto maxLimit = static_cast<double>(_options.maxSpeechSessions);
+    if (succeeded and latency <= _options.targetLatency) {
+        _speechLimit = std::min(_speechLimit + 1.0 / _speechLimit, maxLimit);
+    } else {
+        _speechLimit = std::max(_speechLimit * kBackoffRatio, minLimit);
+    }
+    metrics().speechLimit.set(static_cast<std::int64_t>(_speechLimit));
+}
+
+void
+AdmissionController::release(Kind kind)
+{
+    std::lock_guard lock{_guard};
+    if (kind == Kind::Session) {
+        BOOST_ASSERT(_sessions > 0);
+        _sessions--;
+        metrics().sessions.decrement();
+    } else {
+        BOOST_ASSERT(_speechSessions > 0);
+        _speechSessions--;
+        metrics().speechSessions.decrement();
+    }
+}
+
+} // namespace jar
\ No newline at end of file
@@ -23,6 +23,8 @@
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
+#include <exception>
+
 namespace uuids = boost::uuids;
 
 namespace {
@@ -42,7 +44,7 @@ namespace jar {
 Automation::Ptr
 Automation::create(std::string alias,
                    std::string intent,
-                   Action::List actions,
+                   ActionDefs actions,
                    LaunchStrategy::Ptr launchStrategy)
 {
     return Automation::Ptr{new Automation{generateId(),
@@ -55,7 +57,7 @@ Automation::create(std::string alias,
 Automation::Automation(std::string id,
                        std::string alias,
                        std::string intent,
-                       Action::List actions,
+                       ActionDefs actions,
                        LaunchStrategy::Ptr launchStrategy)
     : _id{std::move(id)}
     , _alias{std::move(alias)}
@@ -84,43 +86,34 @@ Automation::intent() const
     return _intent;
 }
 
-Automation::Ptr
-Automation::clone()
+std::span<const ActionDef>
+Automation::actions() const
 {
-    Action::List actions;
-    std::for_each(_actions.cbegin(), _actions.cend(), [&](const Action::Ptr& action) {
-        actions.push_back(action->clone());
-    });
-    BOOST_ASSERT(not actions.empty());
-
-    LaunchStrategy::Ptr launcher = _launcher->clone();
-    BOOST_ASSERT(launcher);
-
-    const auto id = generateId();
-    BOOST_ASSERT(not id.empty());
-    return Automation::Ptr{new Automation{id, _alias, _intent, std::move(actions), launcher}};
+    return _actions;
 }
 
-void
-Automation::execute(io::any_io_executor executor)
+io::awaitable<std::error_code>
+Automation::run(io::any_io_executor executor) const
 {
     BOOST_ASSERT(_launcher);
-    _launcher->onComplete([weakSelf = weak_from_this()](std::error_code ec) {
-        if (auto self = weakSelf.lock()) {
-            self->onExecuteDone(ec);
-        }
-    });
-
     LOGI("Launch <{}> actions of <{} ({})> automation", _actions.size(), alias(), id());
-    _launcher->launch(std::move(executor), _actions);
+    const auto ec = co_await _launcher->run(std::move(executor), _actions);
+    LOGI("Executing <{} ({})> automation is done: result<{}>", alias(), id(), ec.message());
+    co_return ec;
 }
 
 void
-Automation::onExecuteDone(std::error_code ec)
+Automation::execute(io::any_io_executor executor)
 {
-    LOGI("Executing <{} ({})> automation is done: result<{}>", alias(), id(), ec.message());
-
-    complete(ec);
+    io::co_spawn(executor,
+                 run(executor),
+                 [self = shared_from_this()](const std::exception_ptr& eptr, std::error_code ec) {
+                     if (eptr) {
+                         LOGE("Unable to execute <{} ({})> automation", self->alias(), self->id());
+                         ec = std::make_error_code(std::errc::operation_canceled);
+                     }
+                     self->complete(ec);
+                 });
 }
 
 } // namespace jar
\ No newline at end of file
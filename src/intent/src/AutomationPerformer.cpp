@@ -14,69 +14,140 @@
 
 #include "intent/AutomationPerformer.hpp"
 
+#include "common/Logging.hpp"
 #include "intent/Automation.hpp"
 #include "intent/AutomationRegistry.hpp"
 
-#include <jarvisto/core/Logger.hpp>
-
 #include <boost/assert.hpp>
 
+#include <algorithm>
+#include <exception>
+#include <thread>
+
 namespace jar {
 
 AutomationPerformer::Ptr
 AutomationPerformer::create(io::any_io_executor executor,
-                            std::shared_ptr<AutomationRegistry> registry)
+                            std::shared_ptr<AutomationRegistry> registry,
+                            AutomationQueue::Options options)
 {
-    return Ptr(new AutomationPerformer{std::move(executor), std::move(registry)});
+    return Ptr(new AutomationPerformer{std::move(executor), std::move(registry), options});
 }
 
 AutomationPerformer::AutomationPerformer(io::any_io_executor executor,
-                                         std::shared_ptr<AutomationRegistry> registry)
+                                         std::shared_ptr<AutomationRegistry> registry,
+                                         AutomationQueue::Options options)
     : _executor{std::move(executor)}
     , _registry{std::move(registry)}
+    , _queue{options}
+    , _shards(std::max(1U, std::thread::hardware_concurrency()))
 {
     BOOST_ASSERT(_registry);
 }
 
 void
-AutomationPerformer::perform(const RecognitionResult& result)
+AutomationPerformer::perform(const RecognitionResult& result, Priority priority)
 {
     if (not result) {
         LOGD("Not understood recognition result is given");
         return;
     }
 
+    if (_queue.push(result.intent, priority)) {
+        dispatch();
+    }
+}
+
+std::size_t
+AutomationPerformer::queued() const
+{
+    return _queue.queued();
+}
+
+std::size_t
+AutomationPerformer::running() const
+{
+    std::size_t count{};
+    for (const auto& shard : _shards) {
+        std::lock_guard lock{shard.guard};
+        count += shard.running.size();
+    }
+    return count;
+}
+
+void
+AutomationPerformer::dispatch()
+{
+    /* The automations are handed off to automation executor */
+    for (auto& intent : _queue.pop()) {
+        io::post(_executor, [self = shared_from_this(), intent = std::move(intent)]() {
+            self->doPerform(intent);
+        });
+    }
+}
+
+void
+AutomationPerformer::doPerform(const std::string& intent)
+{
     Automation::Ptr automation;
-    if (automation = _registry->get(result.intent); not automation) {
-        LOGE("Unable to find automation for <{}> intent", result.intent);
+    if (automation = _registry->get(intent); not automation) {
+        LOGE("Unable to find automation for <{}> intent", intent);
+        _queue.release(intent);
+        dispatch();
         return;
     }
 
     BOOST_ASSERT(automation);
-    const auto id = automation->id();
-    _runningList.insert({id, automation});
+    const auto run = _nextRun.fetch_add(1, std::memory_order_relaxed);
+    {
+        auto& shard = this->shard(run);
+        std::lock_guard lock{shard.guard};
+        shard.running.insert({run, automation});
+    }
 
-    automation->onComplete(
-        [id, alias = automation->alias(), weakSelf = weak_from_this()](std::error_code ec) {
+    /* The actions of automation are run on its own strand (the automation is kept alive by
+       completion handler while it's running) */
+    io::any_io_executor strand = io::make_strand(_executor);
+    LOGI("Execute <{} ({})> automation: run<{}>", automation->alias(), automation->id(), run);
+    io::co_spawn(
+        strand,
+        automation->run(strand),
+        [run, automation, weakSelf = weak_from_this()](const std::exception_ptr& eptr,
+                                                       std::error_code ec) {
+            if (eptr) {
+                ec = std::make_error_code(std::errc::operation_canceled);
+            }
             if (auto self = weakSelf.lock()) {
-                self->onAutomationDone(id, alias, ec);
+                self->onAutomationDone(run, automation, ec);
             }
         });
-
-    LOGI("Execute <{} ({})> automation", automation->alias(), id);
-    automation->execute(_executor);
 }
 
 void
-AutomationPerformer::onAutomationDone(const std::string& id,
-                                      const std::string& alias,
+AutomationPerformer::onAutomationDone(std::uint64_t run,
+                                      const std::shared_ptr<Automation>& automation,
                                       std::error_code ec)
 {
-    LOGI("The <{} ({})> automation is done: result<{}>", id, alias, ec.message());
+    LOGI("The <{} ({})> automation is done: run<{}>, result<{}>",
+         automation->alias(),
+         automation->id(),
+         run,
+         ec.message());
 
-    if (const auto count = _runningList.erase(id); count > 0) {
-        LOGD("Remove <{} ({})> automation from running list", id, alias);
+    {
+        auto& shard = this->shard(run);
+        std::lock_guard lock{shard.guard};
+        shard.running.erase(run);
     }
+
+    _queue.release(automation->intent());
+    dispatch();
+}
+
+AutomationPerformer::Shard&
+AutomationPerformer::shard(std::uint64_t run)
+{
+    return _shards[run % _shards.size()];
 }
 
 } // namespace jar
\ No newline at end of file
@@ -0,0 +1,160 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/AutomationQueue.hpp"
+
+#include "common/Logging.hpp"
+#include "common/Metrics.hpp"
+
+#include <boost/assert.hpp>
+
+namespace jar {
+
+namespace {
+
+struct QueueMetrics {
+    Gauge& queued{Metrics::instance().gauge("intent.automation.queued")};
+    Gauge& running{Metrics::instance().gauge("intent.automation.running")};
+    Counter& rejected{Metrics::instance().counter("intent.automation.rejected")};
+    Counter& dropped{Metrics::instance().counter("intent.automation.dropped")};
+    Histogram& wait{Metrics::instance().histogram("intent.automation.queue_time_ms",
+                                                  {1, 10, 50, 100, 250, 500, 1000, 5000})};
+};
+
+QueueMetrics&
+metrics()
+{
+    static QueueMetrics instance;
+    return instance;
+}
+
+} // namespace
+
+AutomationQueue::AutomationQueue(Options options)
+    : _options{options}
+{
+    BOOST_ASSERT(_options.capacity > 0);
+}
+
+const AutomationQueue::Options&
+AutomationQueue::options() const
+{
+    return _options;
+}
+
+std::size_t
+AutomationQueue::queued() const
+{
+    std::lock_guard lock{_guard};
+    return _queued;
+}
+
+std::size_t
+AutomationQueue::running() const
+{
+    std::lock_guard lock{_guard};
+    return _running;
+}
+
+bool
+AutomationQueue::push(std::string intent, Priority priority, Clock::time_point now)
+{
+    std::lock_guard lock{_guard};
+    if (_queued >= _options.capacity and not makeRoom(priority)) {
+        LOGW("Reject <{}> automation upon full queue", intent);
+        metrics().rejected.increment();
+        return false;
+    }
+    _queues[static_cast<std::size_t>(priority)].push_back(Entry{std::move(intent), now});
+    _queued++;
+    metrics().queued.increment();
+    return true;
+}
+
+std::vector<std::string>
+AutomationQueue::pop(Clock::time_point now)
+{
+    std::vector<std::string> intents;
+
+    std::lock_guard lock{_guard};
+    for (auto& queue : _queues) {
+        for (auto it = queue.begin(); it != queue.end();) {
+            if (_options.maxRunning > 0 and _running >= _options.maxRunning) {
+                return intents;
+            }
+            if (not canRun(it->intent)) {
+                ++it;
+                continue;
+            }
+            const auto wait = std::chrono::duration<double, std::milli>(now - it->enqueued);
+            metrics().wait.observe(wait.count());
+            _runningPerAutomation[it->intent]++;
+            _running++;
+            metrics().running.increment();
+            intents.push_back(std::move(it->intent));
+            it = queue.erase(it);
+            _queued--;
+            metrics().queued.decrement();
+        }
+    }
+    return intents;
+}
+
+void
+AutomationQueue::release(const std::string& intent)
+{
+    std::lock_guard lock{_guard};
+    if (auto it = _runningPerAutomation.find(intent); it != _runningPerAutomation.end()) {
+        BOOST_ASSERT(it->second > 0);
+        if (--it->second == 0) {
+            _runningPerAutomation.erase(it);
+        }
+        BOOST_ASSERT(_running > 0);
+        _running--;
+        metrics().running.decrement();
+    }
+}
+
+bool
+AutomationQueue::canRun(const std::string& intent) const
+{
+    if (_options.maxRunningPerAutomation == 0) {
+        return true;
+    }
+    const auto it = _runningPerAutomation.find(intent);
+    return (it == _runningPerAutomation.end() or it->second < _options.maxRunningPerAutomation);
+}
+
+bool
+AutomationQueue::makeRoom(Priority priority)
+{
+    if (_options.overflow == Overflow::Reject) {
+        return false;
+    }
+
+    /* The entry of higher priority class than the given one is never dropped for it */
+    for (auto index = kPriorities; index-- > static_cast<std::size_t>(priority);) {
+        if (auto& queue = _queues[index]; not queue.empty()) {
+            LOGW("Drop <{}> automation upon full queue", queue.front().intent);
+            queue.pop_front();
+            _queued--;
+            metrics().queued.decrement();
+            metrics().dropped.increment();
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace jar
\ No newline at end of file
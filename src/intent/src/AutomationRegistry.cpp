@@ -26,8 +26,9 @@ AutomationRegistry::add(std::shared_ptr<Automation> automation)
     const std::lock_guard lock{_guard};
     auto intent = automation->intent();
     LOGD("Register <{}> automation for <{}> intent", automation->id(), automation->intent());
-    auto [it, ok] = _registry.insert({std::move(intent), std::move(automation)});
-    BOOST_ASSERT(ok);
+    /* The automation given again replaces the previous one (e.g. upon config reload) while
+       the running automation keeps the previous one until done */
+    _registry.insert_or_assign(std::move(intent), std::move(automation));
 }
 
 bool
@@ -43,10 +44,11 @@ AutomationRegistry::get(const std::string& intent)
     const std::unique_lock lock{_guard};
     Automation::Ptr automation;
     if (auto autoIt = _registry.find(intent); autoIt != std::cend(_registry)) {
-        automation = std::get<1>(*autoIt)->clone();
+        /* The automation is immutable and shared by concurrent runs */
+        automation = std::get<1>(*autoIt);
         LOGD("Provide <{}> automation for <{}> intent", automation->id(), intent);
     } else {
-        LOGE("Unable to find automation prototype for <{}> intent", intent);
+        LOGE("Unable to find automation for <{}> intent", intent);
     }
     return automation;
 }
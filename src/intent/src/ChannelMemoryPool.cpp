@@ -0,0 +1,102 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/ChannelMemoryPool.hpp"
+
+#include "common/Metrics.hpp"
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <new>
+
+namespace jar {
+
+namespace {
+
+/* The largest block kept in the pool (the blocks above are allocated directly) */
+constexpr std::size_t kLargestPoolBlock{1024 * 1024};
+
+struct PoolMetrics {
+    Gauge& used{Metrics::instance().gauge("intent.channel.pool_used")};
+    Gauge& budget{Metrics::instance().gauge("intent.channel.pool_budget")};
+    Counter& exhausted{Metrics::instance().counter("intent.channel.pool_exhausted")};
+};
+
+PoolMetrics&
+metrics()
+{
+    static PoolMetrics instance;
+    return instance;
+}
+
+} // namespace
+
+ChannelMemoryPool::Ptr
+ChannelMemoryPool::create(std::size_t budget)
+{
+    return Ptr(new ChannelMemoryPool(budget));
+}
+
+ChannelMemoryPool::ChannelMemoryPool(std::size_t budget)
+    : _budget{budget}
+    , _pool{std::pmr::pool_options{.max_blocks_per_chunk = 0,
+                                   .largest_required_pool_block = kLargestPoolBlock}}
+{
+    metrics().budget.set(static_cast<std::int64_t>(_budget));
+}
+
+std::size_t
+ChannelMemoryPool::budget() const
+{
+    return _budget;
+}
+
+std::size_t
+ChannelMemoryPool::used() const
+{
+    std::lock_guard lock{_guard};
+    return _used;
+}
+
+void*
+ChannelMemoryPool::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    std::lock_guard lock{_guard};
+    if (_budget > 0 and _used + bytes > _budget) {
+        LOGW("Channel memory budget is exhausted: used<{}>, requested<{}>", _used, bytes);
+        metrics().exhausted.increment();
+        throw std::bad_alloc{};
+    }
+    void* ptr = _pool.allocate(bytes, alignment);
+    _used += bytes;
+    metrics().used.set(static_cast<std::int64_t>(_used));
+    return ptr;
+}
+
+void
+ChannelMemoryPool::do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+{
+    std::lock_guard lock{_guard};
+    _pool.deallocate(ptr, bytes, alignment);
+    _used -= bytes;
+    metrics().used.set(static_cast<std::int64_t>(_used));
+}
+
+bool
+ChannelMemoryPool::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return (this == &other);
+}
+
+} // namespace jar
\ No newline at end of file
@@ -14,64 +14,170 @@
 
 #include "intent/Config.hpp"
 
+#include "intent/ActionDef.hpp"
 #include "intent/Automation.hpp"
+#include "intent/HttpAction.hpp"
 #include "intent/IAutomationRegistry.hpp"
 #include "intent/MqttAction.hpp"
+#include "intent/PluginAction.hpp"
 #include "intent/ScriptAction.hpp"
 #include "intent/SequentLaunchStrategy.hpp"
 #include "rintento/Options.hpp"
 
 #include <boost/assert.hpp>
+#include <boost/url/parse.hpp>
 
 #include <jarvisto/core/Logger.hpp>
 
 namespace fs = std::filesystem;
+namespace urls = boost::urls;
 
 namespace jar {
 
 namespace {
 
-Action::Ptr
+std::optional<ActionDef>
 parseMqttAction(const libconfig::Setting& root)
 {
-    std::string topic;
-    if (not root.lookupValue("topic", topic)) {
+    MqttAction::Params params;
+    if (not root.lookupValue("topic", params.topic)) {
         LOGE("No 'topic' field");
-        return {};
+        return std::nullopt;
     }
-    std::string value;
-    if (not root.lookupValue("value", value)) {
+    if (not root.lookupValue("value", params.value)) {
         LOGE("No 'value' field");
-        return {};
+        return std::nullopt;
     }
-    std::string host;
-    if (not root.lookupValue("host", host)) {
+    if (not root.lookupValue("host", params.host)) {
         LOGE("No 'host' field");
-        return {};
+        return std::nullopt;
     }
     uint32_t port{MqttAction::kDefaultPort};
     root.lookupValue("port", port);
-
-    auto action = MqttAction::create(std::move(topic), std::move(value), std::move(host), port);
-    BOOST_ASSERT(action);
+    params.port = static_cast<uint16_t>(port);
 
     std::string user, pass;
     if (root.lookupValue("user", user)) {
         if (root.lookupValue("pass", pass)) {
-            action->credentials(std::move(user), std::move(pass));
+            params.user = std::move(user);
+            params.pass = std::move(pass);
         }
     }
 
-    return action;
+    return params;
 }
 
-Action::Ptr
+std::optional<ActionDef>
+parsePluginAction(const libconfig::Setting& root)
+{
+    std::string path;
+    if (not root.lookupValue("path", path)) {
+        LOGE("No 'path' field");
+        return std::nullopt;
+    }
+    std::string name;
+    if (not root.lookupValue("name", name)) {
+        name = fs::path{path}.stem().string();
+    }
+    std::string config;
+    std::ignore = root.lookupValue("config", config);
+
+    uint32_t timeout = PluginAction::kDefaultTimeout.count();
+    if (root.lookupValue("timeout", timeout) and timeout <= 0) {
+        LOGE("Invalid value for timeout field: {}", timeout);
+        timeout = PluginAction::kDefaultTimeout.count();
+    }
+
+    /* The plugin is loaded once and shared by all runs of action */
+    std::error_code ec;
+    auto plugin = Plugin::load(std::move(name), path, config, ec);
+    if (not plugin) {
+        LOGE("Unable to load <{}> plugin: {}", path, ec.message());
+        return std::nullopt;
+    }
+    return PluginAction::Params{.plugin = std::move(plugin),
+                                .timeout = PluginAction::Timeout{timeout}};
+}
+
+std::optional<ActionDef>
+parseHttpAction(const libconfig::Setting& root, std::shared_ptr<HttpConnectionPool> pool)
+{
+    std::string url;
+    if (not root.lookupValue("url", url)) {
+        LOGE("No 'url' field");
+        return std::nullopt;
+    }
+    const auto view = urls::parse_uri(url);
+    if (not view or (view->scheme_id() != urls::scheme::http
+                     and view->scheme_id() != urls::scheme::https)) {
+        LOGE("Invalid value for url field: {}", url);
+        return std::nullopt;
+    }
+
+    HttpAction::Params params;
+    params.endpoint.host = view->encoded_host().decode();
+    if (params.endpoint.host.empty()) {
+        LOGE("No host in url field: {}", url);
+        return std::nullopt;
+    }
+    params.endpoint.tls = (view->scheme_id() == urls::scheme::https);
+    if (view->has_port()) {
+        params.endpoint.port = view->port();
+    } else {
+        params.endpoint.port = params.endpoint.tls ? "443" : "80";
+    }
+    std::ignore = root.lookupValue("verify", params.endpoint.verify);
+    if (not view->encoded_target().empty()) {
+        params.target = view->encoded_target();
+    }
+
+    if (std::string method; root.lookupValue("method", method)) {
+        params.method = http::string_to_verb(method);
+        if (params.method == http::verb::unknown) {
+            LOGE("Invalid value for method field: {}", method);
+            return std::nullopt;
+        }
+    }
+    std::ignore = root.lookupValue("body", params.body);
+
+    try {
+        for (const auto& e : root["headers"]) {
+            params.headers.push_back(std::make_pair<std::string, std::string>(e.getName(), e));
+        }
+    } catch (const libconfig::SettingTypeException& e) {
+        LOGE("Wrong element type: {}", e.what());
+    } catch (const libconfig::SettingNotFoundException& e) {
+        // Ignore
+    }
+
+    uint32_t timeout{};
+    if (root.lookupValue("connectTimeout", timeout)) {
+        if (timeout > 0) {
+            params.connectTimeout = HttpAction::Timeout{timeout};
+        } else {
+            LOGE("Invalid value for connectTimeout field: {}", timeout);
+        }
+    }
+    if (root.lookupValue("timeout", timeout)) {
+        if (timeout > 0) {
+            params.timeout = HttpAction::Timeout{timeout};
+        } else {
+            LOGE("Invalid value for timeout field: {}", timeout);
+        }
+    }
+
+    /* The connections are shared by all actions to reuse them for the same host */
+    params.pool = std::move(pool);
+    return params;
+}
+
+std::optional<ActionDef>
 parseScriptAction(const libconfig::Setting& root)
 {
     std::string exec;
     if (not root.lookupValue("exec", exec)) {
         LOGE("No 'exec' field");
-        return {};
+        return std::nullopt;
     }
 
     ScriptAction::Args args;
@@ -108,18 +214,24 @@ parseScriptAction(const libconfig::Setting& root)
         timeout = ScriptAction::kDefaultTimeout.count();
     }
 
-    return ScriptAction::create(std::move(exec),
-                                std::move(args),
-                                std::move(home),
-                                std::move(env),
-                                inheritParentEnv,
-                                ScriptAction::Timeout{timeout});
+    ScriptAction::Params params{.exec = std::move(exec),
+                                .args = std::move(args),
+                                .home = std::move(home),
+                                .env = std::move(env),
+                                .inheritParentEnv = inheritParentEnv,
+                                .timeout = ScriptAction::Timeout{timeout},
+                                .plan = {}};
+    /* The action is kept to be resolved upon run (e.g. the program is installed later) */
+    if (const auto ec = ScriptAction::compile(params); ec) {
+        LOGW("Unable to prepare <{}> program: {}", params.exec, ec.message());
+    }
+    return params;
 }
 
-Action::List
-parseActions(const libconfig::Setting& root)
+ActionDefs
+parseActions(const libconfig::Setting& root, const std::shared_ptr<HttpConnectionPool>& pool)
 {
-    Action::List actions;
+    ActionDefs actions;
     for (int i = 0; i < root.getLength(); ++i) {
         std::string type;
         if (not root[i].lookupValue("type", type)) {
@@ -127,13 +239,25 @@ parseActions(const libconfig::Setting& root)
         } else {
             if (type == "script") {
                 if (auto action = parseScriptAction(root[i]); action) {
-                    actions.push_back(std::move(action));
+                    actions.push_back(std::move(*action));
                 }
                 continue;
             }
             if (type == "mqtt") {
                 if (auto action = parseMqttAction(root[i]); action) {
-                    actions.push_back(std::move(action));
+                    actions.push_back(std::move(*action));
+                }
+                continue;
+            }
+            if (type == "plugin") {
+                if (auto action = parsePluginAction(root[i]); action) {
+                    actions.push_back(std::move(*action));
+                }
+                continue;
+            }
+            if (type == "http") {
+                if (auto action = parseHttpAction(root[i], pool); action) {
+                    actions.push_back(std::move(*action));
                 }
                 continue;
             }
@@ -163,6 +287,54 @@ Config::serverThreads() const
     return _serverThreads;
 }
 
+uint32_t
+Config::backendThreads() const
+{
+    return _backendThreads;
+}
+
+uint32_t
+Config::automationThreads() const
+{
+    return _automationThreads;
+}
+
+const SessionOptions&
+Config::sessionOptions() const
+{
+    return _sessionOptions;
+}
+
+const RateLimiter::Options&
+Config::limiterOptions() const
+{
+    return _limiterOptions;
+}
+
+const AdmissionController::Options&
+Config::admissionOptions() const
+{
+    return _admissionOptions;
+}
+
+const AutomationQueue::Options&
+Config::automationQueueOptions() const
+{
+    return _automationQueueOptions;
+}
+
+const HttpConnectionPool::Options&
+Config::httpPoolOptions() const
+{
+    return _httpPoolOptions;
+}
+
+std::shared_ptr<HttpConnectionPool>
+Config::httpPool() const
+{
+    return _httpPool;
+}
+
 std::optional<std::string>
 Config::witRemoteHost() const
 {
@@ -187,6 +359,88 @@ Config::doParse(const libconfig::Config& config)
     try {
         std::ignore = config.lookupValue("server.port", _serverPort);
         std::ignore = config.lookupValue("server.threads", _serverThreads);
+        std::ignore = config.lookupValue("server.backendThreads", _backendThreads);
+        std::ignore = config.lookupValue("server.automationThreads", _automationThreads);
+
+        unsigned int value{};
+        if (config.lookupValue("server.speech.captureSize", value)) {
+            _sessionOptions.speechCaptureSize = value;
+        }
+        if (config.lookupValue("server.speech.retries", value)) {
+            _sessionOptions.speechRetries = value;
+        }
+        if (config.lookupValue("server.speech.channelCapacity", value) and value > 0) {
+            _sessionOptions.speechChannelCapacity = value;
+        }
+        if (config.lookupValue("server.speech.channelBudget", value)) {
+            _sessionOptions.speechChannelBudget = value;
+        }
+        if (config.lookupValue("server.speech.fixedBuffers", value)) {
+            _sessionOptions.speechFixedBuffers = value;
+        }
+        if (config.lookupValue("server.speech.fixedBufferSize", value) and value > 0) {
+            _sessionOptions.speechFixedBufferSize = value;
+        }
+        if (config.lookupValue("server.sessionPoolSize", value)) {
+            _sessionOptions.sessionPoolSize = value;
+        }
+
+        if (config.lookupValue("server.admission.maxSessions", value) and value > 0) {
+            _admissionOptions.maxSessions = value;
+        }
+        if (config.lookupValue("server.admission.minSpeechSessions", value) and value > 0) {
+            _admissionOptions.minSpeechSessions = value;
+        }
+        if (config.lookupValue("server.admission.maxSpeechSessions", value) and value > 0) {
+            _admissionOptions.maxSpeechSessions = value;
+        }
+        if (config.lookupValue("server.admission.targetLatency", value) and value > 0) {
+            _admissionOptions.targetLatency = std::chrono::milliseconds{value};
+        }
+        if (config.lookupValue("server.admission.retryAfter", value)) {
+            _admissionOptions.retryAfter = std::chrono::seconds{value};
+        }
+        if (_admissionOptions.minSpeechSessions > _admissionOptions.maxSpeechSessions) {
+            LOGW("Invalid speech sessions limits: min<{}>, max<{}>",
+                 _admissionOptions.minSpeechSessions,
+                 _admissionOptions.maxSpeechSessions);
+            _admissionOptions.minSpeechSessions = _admissionOptions.maxSpeechSessions;
+        }
+
+        if (config.lookupValue("server.automation.maxRunning", value)) {
+            _automationQueueOptions.maxRunning = value;
+        }
+        if (config.lookupValue("server.automation.maxRunningPerAutomation", value)) {
+            _automationQueueOptions.maxRunningPerAutomation = value;
+        }
+        if (config.lookupValue("server.automation.queueCapacity", value) and value > 0) {
+            _automationQueueOptions.capacity = value;
+        }
+        if (std::string overflow; config.lookupValue("server.automation.overflow", overflow)) {
+            if (overflow == "reject") {
+                _automationQueueOptions.overflow = AutomationQueue::Overflow::Reject;
+            } else if (overflow == "dropOldest") {
+                _automationQueueOptions.overflow = AutomationQueue::Overflow::DropOldest;
+            } else {
+                LOGW("Invalid automation queue overflow: <{}>", overflow);
+            }
+        }
+        if (config.lookupValue("server.automation.http.maxIdlePerHost", value)) {
+            _httpPoolOptions.maxIdlePerHost = value;
+        }
+        if (config.lookupValue("server.automation.http.idleTimeout", value)) {
+            _httpPoolOptions.idleTimeout = std::chrono::milliseconds{value};
+        }
+
+        if (config.lookupValue("limiter.rate", value)) {
+            _limiterOptions.rate = value;
+        }
+        if (config.lookupValue("limiter.burst", value) and value > 0) {
+            _limiterOptions.burst = value;
+        }
+        if (config.lookupValue("limiter.maxWait", value)) {
+            _limiterOptions.maxWait = std::chrono::milliseconds{value};
+        }
 
 #ifdef ENABLE_WIT_SUPPORT
         std::string witRemoteHost;
@@ -216,6 +470,10 @@ Config::doParse(const libconfig::Config& config)
 void
 Config::doParseAutomations(const libconfig::Setting& root)
 {
+    if (not _httpPool) {
+        _httpPool = std::make_shared<HttpConnectionPool>(_httpPoolOptions);
+    }
+
     for (int i = 0; i < root.getLength(); ++i) {
         const auto& automation = root[i];
 
@@ -228,7 +486,8 @@ Config::doParseAutomations(const libconfig::Setting& root)
             continue;
         }
 
-        if (auto actions = parseActions(automation.lookup("actions")); not actions.empty()) {
+        if (auto actions = parseActions(automation.lookup("actions"), _httpPool);
+            not actions.empty()) {
             BOOST_ASSERT(_registry);
             _registry->add(Automation::create(std::move(alias),
                                               std::move(intent),
@@ -0,0 +1,120 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/ExecutorPool.hpp"
+
+#include "common/Logging.hpp"
+#include "common/Metrics.hpp"
+
+#include <boost/assert.hpp>
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+
+namespace jar {
+
+namespace {
+
+Histogram&
+latencyHistogram(const std::string& name)
+{
+    return Metrics::instance().histogram(fmt::format("executor.{}.queue_latency", name),
+                                         {0.1, 0.5, 1, 5, 10, 50, 100, 500, 1000});
+}
+
+} // namespace
+
+ExecutorPool::ExecutorPool(std::string name,
+                           const std::size_t threads,
+                           const std::chrono::milliseconds probeInterval)
+    : _name{std::move(name)}
+    , _threads{std::max<std::size_t>(threads, 1)}
+    , _probeInterval{probeInterval}
+    , _latency{latencyHistogram(_name)}
+    , _context{static_cast<int>(_threads)}
+{
+}
+
+ExecutorPool::~ExecutorPool()
+{
+    stop();
+}
+
+const std::string&
+ExecutorPool::name() const
+{
+    return _name;
+}
+
+std::size_t
+ExecutorPool::threads() const
+{
+    return _threads;
+}
+
+io::any_io_executor
+ExecutorPool::executor()
+{
+    return _context.get_executor();
+}
+
+void
+ExecutorPool::start()
+{
+    BOOST_ASSERT(_workers.empty());
+    if (_context.stopped()) {
+        _context.restart();
+    }
+    _guard.emplace(_context.get_executor());
+    io::co_spawn(_context, probe(), io::detached);
+
+    LOGI("Start <{}> executor pool: threads<{}>", _name, _threads);
+    _workers.reserve(_threads);
+    for (std::size_t n = 0; n < _threads; ++n) {
+        _workers.emplace_back([this]() { _context.run(); });
+    }
+}
+
+void
+ExecutorPool::stop()
+{
+    if (_workers.empty()) {
+        return;
+    }
+    LOGI("Stop <{}> executor pool", _name);
+    _guard.reset();
+    _context.stop();
+    _workers.clear();
+}
+
+io::awaitable<void>
+ExecutorPool::probe()
+{
+    io::steady_timer timer{_context};
+    for (;;) {
+        timer.expires_after(_probeInterval);
+        if (auto [ec] = co_await timer.async_wait(io::as_tuple(io::use_awaitable)); ec) {
+            co_return;
+        }
+        /* The posted handler is queued behind the pending work of pool */
+        const auto start = std::chrono::steady_clock::now();
+        co_await io::post(_context, io::use_awaitable);
+        const std::chrono::duration<double, std::milli> latency
+            = std::chrono::steady_clock::now() - start;
+        _latency.observe(latency.count());
+    }
+}
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,151 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/FixedBufferPool.hpp"
+
+#include "common/Logging.hpp"
+#include "common/Metrics.hpp"
+
+#include <boost/assert.hpp>
+
+#include <exception>
+
+namespace jar {
+
+namespace {
+
+Counter&
+missesCounter()
+{
+    static Counter& counter{Metrics::instance().counter("intent.speech.fixed_buffer_misses")};
+    return counter;
+}
+
+} // namespace
+
+FixedBufferPool::Lease::Lease(std::shared_ptr<FixedBufferPool> pool, const std::size_t index)
+    : _pool{std::move(pool)}
+    , _index{index}
+{
+}
+
+FixedBufferPool::Lease::Lease(Lease&& other) noexcept
+    : _pool{std::move(other._pool)}
+    , _index{other._index}
+{
+}
+
+FixedBufferPool::Lease&
+FixedBufferPool::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other) {
+        if (_pool) {
+            _pool->release(_index);
+        }
+        _pool = std::move(other._pool);
+        _index = other._index;
+    }
+    return *this;
+}
+
+FixedBufferPool::Lease::~Lease()
+{
+    if (_pool) {
+        _pool->release(_index);
+    }
+}
+
+FixedBufferPool::Lease::operator bool() const
+{
+    return static_cast<bool>(_pool);
+}
+
+io::mutable_registered_buffer
+FixedBufferPool::Lease::buffer() const
+{
+    BOOST_ASSERT(_pool);
+    BOOST_ASSERT(_pool->_registration);
+    return (*_pool->_registration)[_index];
+}
+
+FixedBufferPool::Ptr
+FixedBufferPool::create(const io::any_io_executor& executor,
+                        const std::size_t count,
+                        const std::size_t size)
+{
+    return Ptr(new FixedBufferPool{executor, count, size});
+}
+
+FixedBufferPool::FixedBufferPool(const io::any_io_executor& executor,
+                                 const std::size_t count,
+                                 const std::size_t size)
+    : _size{size}
+    , _memory{std::make_unique<std::byte[]>(count * size)}
+{
+    BOOST_ASSERT(size > 0);
+
+    std::vector<io::mutable_buffer> buffers;
+    buffers.reserve(count);
+    for (std::size_t n = 0; n < count; ++n) {
+        buffers.emplace_back(_memory.get() + n * size, size);
+    }
+    try {
+        _registration.emplace(executor, std::move(buffers));
+    } catch (const std::exception& e) {
+        /* The kernel may reject registration (e.g. upon locked memory limit) */
+        LOGW("Unable to register fixed buffers: count<{}>, size<{}>, error<{}>",
+             count,
+             size,
+             e.what());
+        return;
+    }
+    _free.reserve(count);
+    for (std::size_t n = count; n > 0; --n) {
+        _free.push_back(n - 1);
+    }
+}
+
+std::size_t
+FixedBufferPool::count() const
+{
+    return _registration ? _registration->size() : 0;
+}
+
+std::size_t
+FixedBufferPool::size() const
+{
+    return _size;
+}
+
+FixedBufferPool::Lease
+FixedBufferPool::acquire()
+{
+    std::lock_guard lock{_guard};
+    if (_free.empty()) {
+        missesCounter().increment();
+        return {};
+    }
+    const std::size_t index = _free.back();
+    _free.pop_back();
+    return Lease{shared_from_this(), index};
+}
+
+void
+FixedBufferPool::release(const std::size_t index)
+{
+    std::lock_guard lock{_guard};
+    _free.push_back(index);
+}
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,97 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/FixedBufferReader.hpp"
+
+#include <boost/assert.hpp>
+
+#include <cstring>
+
+namespace jar {
+
+FixedBufferReader::FixedBufferReader(FixedBufferPool::Lease lease, Buffer& pending)
+    : _lease{std::move(lease)}
+{
+    BOOST_ASSERT(canTakeOver(_lease, pending));
+    _end = io::buffer_copy(io::buffer(data(), _lease.buffer().size()), pending.data());
+    pending.consume(_end);
+}
+
+bool
+FixedBufferReader::canTakeOver(const FixedBufferPool::Lease& lease, const Buffer& pending)
+{
+    return (lease and pending.size() <= lease.buffer().size());
+}
+
+io::awaitable<sys::error_code>
+FixedBufferReader::read(tcp::socket& socket, Parser& parser)
+{
+    const std::size_t capacity = _lease.buffer().size();
+    /* The parser consumes as much data as possible (as http::async_read() does) */
+    parser.eager(true);
+    for (;;) {
+        if (_begin < _end) {
+            sys::error_code ec;
+            const std::size_t n = parser.put(io::buffer(data() + _begin, _end - _begin), ec);
+            _begin += n;
+            if (ec == http::error::need_more) {
+                ec = {};
+            } else if (ec or parser.is_done()) {
+                co_return ec;
+            } else if (n > 0) {
+                continue;
+            }
+        }
+        if (parser.is_done()) {
+            co_return sys::error_code{};
+        }
+
+        compact();
+        if (_end == capacity) {
+            co_return http::error::buffer_overflow;
+        }
+        /* The registered buffer makes io_uring backend to read with fixed buffer */
+        auto [ec, n] = co_await socket.async_read_some(_lease.buffer() + _end,
+                                                       io::as_tuple(io::use_awaitable));
+        if (ec == io::error::eof) {
+            parser.put_eof(ec);
+            co_return ec;
+        }
+        if (ec) {
+            co_return ec;
+        }
+        _end += n;
+    }
+}
+
+std::byte*
+FixedBufferReader::data() const
+{
+    return static_cast<std::byte*>(_lease.buffer().data());
+}
+
+void
+FixedBufferReader::compact()
+{
+    /* The unparsed data is moved to the beginning to make room for reading */
+    if (_begin == _end) {
+        _begin = _end = 0;
+    } else if (_begin > 0) {
+        std::memmove(data(), data() + _begin, _end - _begin);
+        _end -= _begin;
+        _begin = 0;
+    }
+}
+
+} // namespace jar
\ No newline at end of file
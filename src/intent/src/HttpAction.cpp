@@ -0,0 +1,90 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/HttpAction.hpp"
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <boost/assert.hpp>
+
+#include <exception>
+
+namespace jar {
+
+Action::Ptr
+HttpAction::create(Params params)
+{
+    BOOST_ASSERT(params.pool);
+    return Action::Ptr{new HttpAction{std::move(params)}};
+}
+
+HttpAction::HttpAction(Params params)
+    : _params{std::move(params)}
+{
+}
+
+Action::Ptr
+HttpAction::clone() const
+{
+    return Action::Ptr{new HttpAction{_params}};
+}
+
+io::awaitable<std::error_code>
+HttpAction::run(io::any_io_executor executor)
+{
+    co_return co_await run(_params, std::move(executor));
+}
+
+io::awaitable<std::error_code>
+HttpAction::run(const Params& params, io::any_io_executor executor)
+{
+    try {
+        co_return co_await send(params, std::move(executor));
+    } catch (const sys::system_error& e) {
+        LOGE("Unable to send request to <{}> host: {}", params.endpoint.host, e.what());
+        if (e.code() == beast::error::timeout) {
+            co_return std::make_error_code(std::errc::timed_out);
+        }
+        co_return std::error_code{e.code()};
+    } catch (const std::exception& e) {
+        LOGE("Exception was occurred: {}", e.what());
+        co_return std::make_error_code(std::errc::connection_refused);
+    }
+}
+
+io::awaitable<std::error_code>
+HttpAction::send(const Params& params, io::any_io_executor executor)
+{
+    BOOST_ASSERT(params.pool);
+
+    HttpConnectionPool::Request request{params.method, params.target, kHttpVersion11};
+    for (const auto& [name, value] : params.headers) {
+        request.set(name, value);
+    }
+    request.body() = params.body;
+
+    const auto response = co_await params.pool->send(
+        params.endpoint, std::move(request), params.connectTimeout, params.timeout, executor);
+    if (http::to_status_class(response.result()) != http::status_class::successful) {
+        LOGE("Request to <{}> host has failed: status<{}>",
+             params.endpoint.host,
+             response.result_int());
+        co_return std::make_error_code(std::errc::protocol_error);
+    }
+
+    LOGD("Request to <{}> host was successful", params.endpoint.host);
+    co_return std::error_code{};
+}
+
+} // namespace jar
\ No newline at end of file
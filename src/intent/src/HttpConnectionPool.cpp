@@ -0,0 +1,376 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/HttpConnectionPool.hpp"
+
+#include "common/Metrics.hpp"
+
+#include <boost/assert.hpp>
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <string_view>
+#include <tuple>
+#include <variant>
+
+namespace jar {
+
+namespace {
+
+struct PoolMetrics {
+    Counter& hits{Metrics::instance().counter("intent.http.pool_hits")};
+    Counter& misses{Metrics::instance().counter("intent.http.pool_misses")};
+    Counter& resumed{Metrics::instance().counter("intent.http.tls_resumed")};
+};
+
+PoolMetrics&
+metrics()
+{
+    static PoolMetrics instance;
+    return instance;
+}
+
+std::string
+makeKey(const HttpConnectionPool::Endpoint& endpoint)
+{
+    std::string key{endpoint.tls ? "https://" : "http://"};
+    key.append(endpoint.host).append(":").append(endpoint.port);
+    if (endpoint.tls and not endpoint.verify) {
+        key.append("#noverify");
+    }
+    return key;
+}
+
+/* Returns the value of host field (the port is given unless it's default one of scheme) */
+std::string
+makeHost(const HttpConnectionPool::Endpoint& endpoint)
+{
+    const std::string_view defaultPort{endpoint.tls ? "443" : "80"};
+    if (endpoint.port.empty() or endpoint.port == defaultPort) {
+        return endpoint.host;
+    }
+    std::string host{endpoint.host};
+    host.append(":").append(endpoint.port);
+    return host;
+}
+
+/* Tells whether the request might be sent again without changing the effect (RFC 9110) */
+bool
+isIdempotent(http::verb method)
+{
+    switch (method) {
+    case http::verb::get:
+    case http::verb::head:
+    case http::verb::options:
+    case http::verb::trace:
+    case http::verb::put:
+    case http::verb::delete_:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/* Tells whether the connection was closed by server (e.g. upon keep-alive timeout) */
+bool
+isClosed(const sys::error_code& ec)
+{
+    return (ec == http::error::end_of_stream or ec == io::error::eof
+            or ec == io::error::connection_reset or ec == io::error::broken_pipe
+            or ec == ssl::error::stream_truncated);
+}
+
+} // namespace
+
+class HttpConnectionPool::Connection {
+public:
+    using SecureStream = beast::ssl_stream<beast::tcp_stream>;
+
+    explicit Connection(const io::any_io_executor& executor)
+        : _stream{std::in_place_type<beast::tcp_stream>, io::make_strand(executor)}
+    {
+    }
+
+    Connection(const io::any_io_executor& executor, ssl::context& context)
+        : _stream{std::in_place_type<SecureStream>, io::make_strand(executor), context}
+    {
+    }
+
+    /* Returns the strand the connection is used on */
+    [[nodiscard]] io::any_io_executor
+    executor()
+    {
+        return lowest().get_executor();
+    }
+
+    [[nodiscard]] SecureStream*
+    secure()
+    {
+        return std::get_if<SecureStream>(&_stream);
+    }
+
+    [[nodiscard]] bool
+    keepAlive() const
+    {
+        return _keepAlive;
+    }
+
+    /* Tells whether the idle connection is still open (nothing is expected from server) */
+    [[nodiscard]] bool
+    alive()
+    {
+        auto& socket = lowest().socket();
+        sys::error_code ec;
+        socket.non_blocking(true, ec);
+        if (ec) {
+            return false;
+        }
+        char byte{};
+        std::ignore = socket.receive(io::buffer(&byte, 1), tcp::socket::message_peek, ec);
+        const bool alive = (ec == io::error::would_block);
+        socket.non_blocking(false, ec);
+        return alive;
+    }
+
+    io::awaitable<void>
+    connect(tcp::resolver::results_type endpoints, Timeout timeout)
+    {
+        lowest().expires_after(timeout);
+        co_await lowest().async_connect(endpoints, io::use_awaitable);
+        if (auto* stream = secure(); stream) {
+            lowest().expires_after(timeout);
+            co_await stream->async_handshake(ssl::stream_base::client, io::use_awaitable);
+        }
+        lowest().expires_never();
+    }
+
+    io::awaitable<Response>
+    send(const Request& request, Timeout timeout)
+    {
+        _keepAlive = false;
+        lowest().expires_after(timeout);
+        co_await std::visit(
+            [&](auto& stream) { return http::async_write(stream, request, io::use_awaitable); },
+            _stream);
+        Response response;
+        co_await std::visit(
+            [&](auto& stream) {
+                return http::async_read(stream, _buffer, response, io::use_awaitable);
+            },
+            _stream);
+        lowest().expires_never();
+        _keepAlive = response.keep_alive();
+        co_return response;
+    }
+
+private:
+    beast::tcp_stream&
+    lowest()
+    {
+        return std::visit(
+            [](auto& stream) -> beast::tcp_stream& { return beast::get_lowest_layer(stream); },
+            _stream);
+    }
+
+private:
+    std::variant<beast::tcp_stream, SecureStream> _stream;
+    beast::flat_buffer _buffer;
+    bool _keepAlive{false};
+};
+
+HttpConnectionPool::HttpConnectionPool(Options options)
+    : _options{options}
+    , _tls{ssl::context::tls_client}
+{
+    sys::error_code ec;
+    _tls.set_default_verify_paths(ec);
+    if (ec) {
+        LOGW("Unable to use default certificate paths: {}", ec.message());
+    }
+}
+
+HttpConnectionPool::~HttpConnectionPool() = default;
+
+const HttpConnectionPool::Options&
+HttpConnectionPool::options() const
+{
+    return _options;
+}
+
+std::size_t
+HttpConnectionPool::idle() const
+{
+    const std::lock_guard lock{_guard};
+    std::size_t count{};
+    for (const auto& [_, connections] : _idle) {
+        count += connections.size();
+    }
+    return count;
+}
+
+void
+HttpConnectionPool::clear()
+{
+    decltype(_idle) idle;
+    {
+        const std::lock_guard lock{_guard};
+        idle.swap(_idle);
+    }
+}
+
+io::awaitable<HttpConnectionPool::Response>
+HttpConnectionPool::send(const Endpoint& endpoint,
+                         Request request,
+                         Timeout connectTimeout,
+                         Timeout timeout,
+                         io::any_io_executor executor)
+{
+    BOOST_ASSERT(not endpoint.host.empty());
+    request.set(http::field::host, makeHost(endpoint));
+    request.keep_alive(true);
+    request.prepare_payload();
+
+    const std::string key = makeKey(endpoint);
+    if (auto connection = acquire(key); connection and connection->alive()) {
+        metrics().hits.increment();
+        try {
+            auto response = co_await io::co_spawn(
+                connection->executor(), connection->send(request, timeout), io::use_awaitable);
+            release(key, std::move(connection));
+            co_return response;
+        } catch (const sys::system_error& e) {
+            /* The server might have acted on the request before closing the connection, so
+               only idempotent request is sent again */
+            if (not isClosed(e.code()) or not isIdempotent(request.method())) {
+                throw;
+            }
+            LOGD("Idle connection to <{}> was closed: {}", key, e.code().message());
+        }
+    }
+
+    metrics().misses.increment();
+    auto connection = co_await connect(endpoint, key, connectTimeout, std::move(executor));
+    auto response = co_await io::co_spawn(
+        connection->executor(), connection->send(request, timeout), io::use_awaitable);
+    release(key, std::move(connection));
+    co_return response;
+}
+
+HttpConnectionPool::ConnectionPtr
+HttpConnectionPool::acquire(const std::string& key)
+{
+    const auto now = std::chrono::steady_clock::now();
+    const std::lock_guard lock{_guard};
+    const auto it = _idle.find(key);
+    if (it == _idle.end() or it->second.empty()) {
+        return {};
+    }
+    /* The most recently used connection is taken (the rest is expired if it's expired) */
+    auto& connections = it->second;
+    Idle idle = std::move(connections.back());
+    connections.pop_back();
+    if (now - idle.since >= _options.idleTimeout) {
+        connections.clear();
+        return {};
+    }
+    return std::move(idle.connection);
+}
+
+void
+HttpConnectionPool::release(const std::string& key, ConnectionPtr connection)
+{
+    BOOST_ASSERT(connection);
+    if (auto* stream = connection->secure(); stream) {
+        /* The session ticket of TLS 1.3 is given after the handshake */
+        storeSession(key, stream->native_handle());
+    }
+    if (not connection->keepAlive() or _options.maxIdlePerHost == 0) {
+        return;
+    }
+
+    const std::lock_guard lock{_guard};
+    auto& connections = _idle[key];
+    if (connections.size() >= _options.maxIdlePerHost) {
+        connections.erase(connections.begin());
+    }
+    connections.push_back(Idle{std::move(connection), std::chrono::steady_clock::now()});
+}
+
+io::awaitable<HttpConnectionPool::ConnectionPtr>
+HttpConnectionPool::connect(const Endpoint& endpoint,
+                            const std::string& key,
+                            Timeout timeout,
+                            io::any_io_executor executor)
+{
+    LOGD("Resolve <{}> address", endpoint.host);
+    tcp::resolver resolver{executor};
+    const auto endpoints
+        = co_await resolver.async_resolve(endpoint.host, endpoint.port, io::use_awaitable);
+
+    if (not endpoint.tls) {
+        auto connection = std::make_unique<Connection>(executor);
+        co_await io::co_spawn(
+            connection->executor(), connection->connect(endpoints, timeout), io::use_awaitable);
+        co_return connection;
+    }
+
+    auto connection = std::make_unique<Connection>(executor, _tls);
+    auto& stream = *connection->secure();
+    std::error_code ec;
+    setSniHostname(stream, endpoint.host, ec);
+    if (ec) {
+        LOGW("Unable to set SNI hostname");
+    }
+    if (endpoint.verify) {
+        stream.set_verify_mode(ssl::verify_peer);
+        setServerHostname(stream, endpoint.host, ec);
+        if (ec) {
+            LOGW("Unable to set server to use in verification process");
+        }
+    } else {
+        stream.set_verify_mode(ssl::verify_none);
+    }
+    if (const auto cached = session(key); cached) {
+        ::SSL_set_session(stream.native_handle(), cached.get());
+    }
+
+    co_await io::co_spawn(
+        connection->executor(), connection->connect(endpoints, timeout), io::use_awaitable);
+    if (::SSL_session_reused(stream.native_handle())) {
+        metrics().resumed.increment();
+    }
+    storeSession(key, stream.native_handle());
+    co_return connection;
+}
+
+std::shared_ptr<SSL_SESSION>
+HttpConnectionPool::session(const std::string& key) const
+{
+    const std::lock_guard lock{_guard};
+    const auto it = _sessions.find(key);
+    return (it != _sessions.end()) ? it->second : nullptr;
+}
+
+void
+HttpConnectionPool::storeSession(const std::string& key, SSL* handle)
+{
+    SSL_SESSION* session = ::SSL_get1_session(handle);
+    if (session == nullptr) {
+        return;
+    }
+    const std::lock_guard lock{_guard};
+    _sessions.insert_or_assign(key, std::shared_ptr<SSL_SESSION>{session, &::SSL_SESSION_free});
+}
+
+} // namespace jar
\ No newline at end of file
@@ -17,6 +17,8 @@
 #include "intent/AutomationPerformer.hpp"
 #include "intent/AutomationRegistry.hpp"
 #include "intent/Config.hpp"
+#include "intent/ExecutorPool.hpp"
+#include "intent/LimitedRecognitionFactory.hpp"
 #include "intent/RecognitionServer.hpp"
 #include "rintento/Options.hpp"
 #ifdef ENABLE_WIT_SUPPORT
@@ -25,7 +27,6 @@
 
 #include <jarvisto/core/Application.hpp>
 #include <jarvisto/core/Logger.hpp>
-#include <jarvisto/network/Worker.hpp>
 
 #include <boost/assert.hpp>
 
@@ -60,21 +61,44 @@ public:
             LOGE("Unable to load config");
         }
 
-        _worker = std::make_unique<Worker>(_config->serverThreads());
-        _performer = AutomationPerformer::create(_worker->executor(), _registry);
+#ifdef ENABLE_IO_URING
+        LOGI("Run network I/O on io_uring backend");
+#endif
+        /* The client connections, backend recognitions and automation actions are run
+           by separate pools handing off the work between each other */
+        _ingress = std::make_unique<ExecutorPool>("ingress", _config->serverThreads());
+        _backend = std::make_unique<ExecutorPool>("backend", _config->backendThreads());
+        _automation
+            = std::make_unique<ExecutorPool>("automation", _config->automationThreads());
+        _performer = AutomationPerformer::create(
+            _automation->executor(), _registry, _config->automationQueueOptions());
         _factory = getFactory();
         if (not _factory) {
             LOGE("Recognition factory is not available");
         } else {
-            _server = RecognitionServer::create(_worker->executor(), _factory, _performer);
+            if (auto limiter = std::make_shared<RateLimiter>(_config->limiterOptions());
+                limiter->enabled()) {
+                LOGI("Limit the rate of recognitions: rate<{}>", limiter->options().rate);
+                _factory = std::make_shared<LimitedRecognitionFactory>(_factory, limiter);
+            }
+            _server = RecognitionServer::create(_ingress->executor(),
+                                                _factory,
+                                                _performer,
+                                                _config->sessionOptions(),
+                                                _config->admissionOptions(),
+                                                _backend->executor());
         }
     }
 
     void
     setUp(Application& /*application*/)
     {
-        BOOST_ASSERT(_worker);
-        _worker->start();
+        BOOST_ASSERT(_ingress);
+        BOOST_ASSERT(_backend);
+        BOOST_ASSERT(_automation);
+        _automation->start();
+        _backend->start();
+        _ingress->start();
 
         const auto port = _config->serverPort();
         BOOST_ASSERT(_server);
@@ -84,8 +108,19 @@ public:
     void
     tearDown()
     {
-        if (_worker) {
-            _worker->stop();
+        /* The ingress is stopped first to not hand off any work to stopped pools */
+        if (_ingress) {
+            _ingress->stop();
+        }
+        if (_backend) {
+            _backend->stop();
+        }
+        if (_automation) {
+            _automation->stop();
+        }
+        /* The idle connections of HTTP actions are closed before their executor is gone */
+        if (auto pool = _config ? _config->httpPool() : nullptr; pool) {
+            pool->clear();
         }
     }
 
@@ -94,8 +129,10 @@ public:
     {
         _server.reset();
         _factory.reset();
-        _worker.reset();
         _performer.reset();
+        _ingress.reset();
+        _backend.reset();
+        _automation.reset();
         _config.reset();
         _registry.reset();
     }
@@ -104,7 +141,9 @@ private:
     std::unique_ptr<Config> _config;
     std::shared_ptr<AutomationRegistry> _registry;
     std::shared_ptr<AutomationPerformer> _performer;
-    std::unique_ptr<Worker> _worker;
+    std::unique_ptr<ExecutorPool> _ingress;
+    std::unique_ptr<ExecutorPool> _backend;
+    std::unique_ptr<ExecutorPool> _automation;
     std::shared_ptr<IRecognitionFactory> _factory;
     std::shared_ptr<RecognitionServer> _server;
 };
@@ -0,0 +1,51 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/LimitedRecognition.hpp"
+
+#include "common/Errors.hpp"
+
+#include <boost/assert.hpp>
+
+namespace jar {
+
+LimitedRecognition::Ptr
+LimitedRecognition::create(Factory factory, std::shared_ptr<RateLimiter> limiter)
+{
+    return Ptr(new LimitedRecognition(std::move(factory), std::move(limiter)));
+}
+
+LimitedRecognition::LimitedRecognition(Factory factory, std::shared_ptr<RateLimiter> limiter)
+    : _factory{std::move(factory)}
+    , _limiter{std::move(limiter)}
+{
+    BOOST_ASSERT(_factory);
+    BOOST_ASSERT(_limiter);
+}
+
+io::awaitable<RecognitionResult>
+LimitedRecognition::run()
+{
+    /* The recognition might be cancelled while waiting in the queue of limiter */
+    if (not co_await _limiter->acquire(onCancel())) {
+        throw sys::system_error{RecognitionErrc::RateLimited};
+    }
+    /* The backend resources (e.g. balancer endpoint) are taken only by admitted recognition */
+    auto recognition = _factory();
+    BOOST_ASSERT(recognition);
+    onCancel().assign([recognition](auto) { recognition->cancel(); });
+    co_return co_await recognition->run();
+}
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,65 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/LimitedRecognitionFactory.hpp"
+
+#include "intent/LimitedRecognition.hpp"
+
+#include <boost/assert.hpp>
+
+namespace jar {
+
+LimitedRecognitionFactory::LimitedRecognitionFactory(std::shared_ptr<IRecognitionFactory> factory,
+                                                     std::shared_ptr<RateLimiter> limiter)
+    : _factory{std::move(factory)}
+    , _limiter{std::move(limiter)}
+{
+    BOOST_ASSERT(_factory);
+    BOOST_ASSERT(_limiter);
+}
+
+bool
+LimitedRecognitionFactory::canRecognizeMessage() const
+{
+    return _factory->canRecognizeMessage();
+}
+
+std::shared_ptr<Recognition>
+LimitedRecognitionFactory::message(io::any_io_executor executor, std::string message)
+{
+    return LimitedRecognition::create(
+        [factory = _factory, executor = std::move(executor), message = std::move(message)]() {
+            return factory->message(executor, message);
+        },
+        _limiter);
+}
+
+bool
+LimitedRecognitionFactory::canRecognizeSpeech() const
+{
+    return _factory->canRecognizeSpeech();
+}
+
+std::shared_ptr<Recognition>
+LimitedRecognitionFactory::speech(io::any_io_executor executor,
+                                  std::shared_ptr<DataChannel> channel)
+{
+    return LimitedRecognition::create(
+        [factory = _factory, executor = std::move(executor), channel = std::move(channel)]() {
+            return factory->speech(executor, channel);
+        },
+        _limiter);
+}
+
+} // namespace jar
\ No newline at end of file
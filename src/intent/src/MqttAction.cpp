@@ -25,95 +25,93 @@ namespace jar {
 std::shared_ptr<MqttAction>
 MqttAction::create(std::string topic, std::string value, std::string host, uint16_t port)
 {
-    return std::shared_ptr<MqttAction>{
-        new MqttAction{std::move(topic), std::move(value), std::move(host), port}};
+    return std::shared_ptr<MqttAction>{new MqttAction{Params{.topic = std::move(topic),
+                                                             .value = std::move(value),
+                                                             .host = std::move(host),
+                                                             .port = port,
+                                                             .user = {},
+                                                             .pass = {}}}};
 }
 
-MqttAction::MqttAction(std::string topic, std::string value, std::string host, uint16_t port)
-    : _topic{std::move(topic)}
-    , _value{std::move(value)}
-    , _host{std::move(host)}
-    , _port{port}
+MqttAction::MqttAction(Params params)
+    : _params{std::move(params)}
 {
 }
 
 void
 MqttAction::credentials(std::string user, std::string pass)
 {
-    _user = std::move(user);
-    _pass = std::move(pass);
+    _params.user = std::move(user);
+    _params.pass = std::move(pass);
 }
 
 std::shared_ptr<Action>
 MqttAction::clone() const
 {
-    auto action = std::shared_ptr<MqttAction>{new MqttAction{_topic, _value, _host, _port}};
-    if (_user and _pass) {
-        action->credentials(*_user, *_pass);
-    }
-    return action;
+    return std::shared_ptr<MqttAction>{new MqttAction{_params}};
 }
 
-void
-MqttAction::execute(io::any_io_executor executor)
+io::awaitable<std::error_code>
+MqttAction::run(io::any_io_executor executor)
 {
-    io::co_spawn(executor, send(), [this](const std::exception_ptr& eptr) {
-        try {
-            if (eptr) {
-                std::rethrow_exception(eptr);
-            }
-        } catch (const std::system_error& e) {
-            LOGE("Exception was occurred: {}", e.what());
-            complete(e.code());
-        } catch (const std::exception& e) {
-            LOGE("Exception was occurred: {}", e.what());
-            complete(std::make_error_code(std::errc::connection_refused));
-        }
-    });
+    co_return co_await run(_params, std::move(executor));
+}
+
+io::awaitable<std::error_code>
+MqttAction::run(const Params& params, io::any_io_executor executor)
+{
+    try {
+        co_return co_await send(params, std::move(executor));
+    } catch (const std::system_error& e) {
+        LOGE("Exception was occurred: {}", e.what());
+        co_return e.code();
+    } catch (const std::exception& e) {
+        LOGE("Exception was occurred: {}", e.what());
+        co_return std::make_error_code(std::errc::connection_refused);
+    }
 }
 
-io::awaitable<void>
-MqttAction::send()
+io::awaitable<std::error_code>
+MqttAction::send(const Params& params, io::any_io_executor executor)
 {
-    MqttAsyncClient client{co_await io::this_coro::executor};
+    /* The cancellation of awaiting coroutine is forwarded to the client operations */
+    MqttAsyncClient client{std::move(executor)};
 
-    if (_user and _pass) {
-        if (auto ec = client.credentials(*_user, *_pass); ec) {
+    if (params.user and params.pass) {
+        if (auto ec = client.credentials(*params.user, *params.pass); ec) {
             LOGE("Unable to set MQTT credentials: {}", ec.message());
-            complete(ec);
-            co_return;
+            co_return ec;
         }
     } else {
         LOGD("MQTT credentials are missing");
     }
 
-    auto [ec, rc] = co_await client.connect(_host, _port, kDefaultKeepAlive, io::use_awaitable);
+    auto [ec, rc]
+        = co_await client.connect(params.host, params.port, kDefaultKeepAlive, io::use_awaitable);
     if (ec) {
-        LOGE("Unable connect to MQTT <{}> host: {}", _host, ec.message());
-        complete(ec);
-        co_return;
+        LOGE("Unable connect to MQTT <{}> host: {}", params.host, ec.message());
+        co_return ec;
     } else {
         if (rc != MqttReturnCode::Accepted) {
-            LOGE("Connecting to <{}> host has failed: {}", _host, rc);
-            complete(ec);
-            co_return;
+            LOGE("Connecting to <{}> host has failed: {}", params.host, rc);
+            co_return std::make_error_code(std::errc::connection_refused);
         } else {
-            LOGD("Connection to <{}> host was established", _host);
+            LOGD("Connection to <{}> host was established", params.host);
         }
     }
 
-    ec = co_await client.publish(_topic, _value, MqttQoS::Level2, false, io::use_awaitable);
+    ec = co_await client.publish(
+        params.topic, params.value, MqttQoS::Level2, false, io::use_awaitable);
     if (ec) {
         std::ignore = co_await client.disconnect(io::use_awaitable);
-        LOGE("Unable to publish to <{}> topic: {}", _topic, ec.message());
-        complete(ec);
-        co_return;
+        LOGE("Unable to publish to <{}> topic: {}", params.topic, ec.message());
+        co_return ec;
     } else {
-        LOGD("Publishing to <{}> was successful", _topic);
+        LOGD("Publishing to <{}> was successful", params.topic);
         std::ignore = co_await client.disconnect(io::use_awaitable);
     }
 
-    complete();
+    co_return std::error_code{};
 }
 
 } // namespace jar
\ No newline at end of file
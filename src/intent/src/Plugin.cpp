@@ -0,0 +1,179 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/Plugin.hpp"
+
+#include "common/Metrics.hpp"
+#include "coro/Asio.hpp"
+
+#include <boost/asio/experimental/awaitable_operators.hpp>
+#include <boost/assert.hpp>
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <spdlog/fmt/fmt.h>
+
+#include <dlfcn.h>
+
+using namespace boost::asio::experimental::awaitable_operators;
+
+namespace jar {
+
+namespace {
+
+/* The execution shared with plugin (it's kept alive until completed) */
+struct Call {
+    Call(const io::any_io_executor& executor, Plugin::Ptr plugin)
+        : channel{executor, 1}
+        , plugin{std::move(plugin)}
+    {
+    }
+
+    ioe::channel<void(sys::error_code, int)> channel;
+    /* The plugin is not unloaded while the execution is running */
+    Plugin::Ptr plugin;
+    std::shared_ptr<Call> self;
+};
+
+/* Hands off the completion (given on any thread) to the strand of awaiting coroutine */
+void
+complete(void* handle, int error)
+{
+    BOOST_ASSERT(handle);
+    auto call = std::move(static_cast<Call*>(handle)->self);
+    BOOST_ASSERT(call);
+    auto executor = call->channel.get_executor();
+    io::post(executor, [call = std::move(call), error]() {
+        std::ignore = call->channel.try_send(sys::error_code{}, error);
+    });
+}
+
+template<typename T>
+T
+symbol(void* library, const char* name)
+{
+    return reinterpret_cast<T>(::dlsym(library, name));
+}
+
+} // namespace
+
+Plugin::Ptr
+Plugin::load(std::string name,
+             const std::filesystem::path& path,
+             const std::string& config,
+             std::error_code& ec)
+{
+    /* The library is never unmapped (the thread of plugin may still return from callback) */
+    void* library = ::dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL | RTLD_NODELETE);
+    if (library == nullptr) {
+        LOGE("Unable to load <{}> plugin: {}", name, ::dlerror());
+        ec = std::make_error_code(std::errc::no_such_file_or_directory);
+        return {};
+    }
+
+    Ptr plugin{new Plugin{std::move(name), library}};
+    const auto init = symbol<rintento_plugin_init_fn>(library, RINTENTO_PLUGIN_INIT);
+    plugin->_execute = symbol<rintento_plugin_execute_fn>(library, RINTENTO_PLUGIN_EXECUTE);
+    plugin->_cancel = symbol<rintento_plugin_cancel_fn>(library, RINTENTO_PLUGIN_CANCEL);
+    plugin->_free = symbol<rintento_plugin_free_fn>(library, RINTENTO_PLUGIN_FREE);
+    if (init == nullptr or plugin->_execute == nullptr or plugin->_cancel == nullptr) {
+        LOGE("Unable to find functions of <{}> plugin", plugin->name());
+        ec = std::make_error_code(std::errc::function_not_supported);
+        return {};
+    }
+
+    plugin->_state = init(RINTENTO_PLUGIN_ABI_VERSION, config.c_str());
+    if (plugin->_state == nullptr) {
+        LOGE("Unable to initialize <{}> plugin", plugin->name());
+        ec = std::make_error_code(std::errc::invalid_argument);
+        return {};
+    }
+
+    ec.clear();
+    LOGI("Plugin <{}> was loaded from <{}> path", plugin->name(), path);
+    return plugin;
+}
+
+Plugin::Plugin(std::string name, void* library)
+    : _name{std::move(name)}
+    , _library{library}
+    , _latency{Metrics::instance().histogram(fmt::format("intent.plugin.{}.latency_ms", _name),
+                                             {1, 5, 10, 50, 100, 500, 1000, 5000})}
+    , _failures{Metrics::instance().counter(fmt::format("intent.plugin.{}.failures", _name))}
+    , _timeouts{Metrics::instance().counter(fmt::format("intent.plugin.{}.timeouts", _name))}
+{
+    BOOST_ASSERT(_library);
+}
+
+Plugin::~Plugin()
+{
+    if (_state != nullptr and _free != nullptr) {
+        _free(_state);
+    }
+    ::dlclose(_library);
+}
+
+const std::string&
+Plugin::name() const
+{
+    return _name;
+}
+
+io::awaitable<std::error_code>
+Plugin::execute(Timeout timeout)
+{
+    BOOST_ASSERT(_state);
+
+    const auto executor = co_await io::this_coro::executor;
+    const auto start = std::chrono::steady_clock::now();
+    auto call = std::make_shared<Call>(executor, shared_from_this());
+    call->self = call;
+    if (const int error = _execute(_state, call.get(), &complete); error != 0) {
+        call->self.reset();
+        _failures.increment();
+        LOGE("Unable to start <{}> plugin execution: error<{}>", _name, error);
+        co_return std::error_code{error, std::generic_category()};
+    }
+
+    io::steady_timer timer{executor, timeout};
+    auto result = co_await (call->channel.async_receive(io::as_tuple(io::use_awaitable))
+                            || timer.async_wait(io::as_tuple(io::use_awaitable)));
+    if (const auto cs = co_await io::this_coro::cancellation_state;
+        cs.cancelled() != io::cancellation_type::none) {
+        LOGI("Cancel <{}> plugin execution", _name);
+        _cancel(_state, call.get());
+        co_return std::make_error_code(std::errc::operation_canceled);
+    }
+    if (result.index() == 1) {
+        LOGI("Cancel <{}> plugin execution due to timeout", _name);
+        _cancel(_state, call.get());
+        _timeouts.increment();
+        co_return std::make_error_code(std::errc::timed_out);
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    _latency.observe(std::chrono::duration<double, std::milli>(elapsed).count());
+    const auto [ec, error] = std::get<0>(result);
+    if (ec) {
+        co_return ec;
+    }
+    if (error != 0) {
+        _failures.increment();
+        LOGE("Plugin <{}> execution failed: error<{}>", _name, error);
+        co_return std::error_code{error, std::generic_category()};
+    }
+    co_return std::error_code{};
+}
+
+} // namespace jar
\ No newline at end of file
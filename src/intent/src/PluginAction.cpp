@@ -0,0 +1,53 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/PluginAction.hpp"
+
+#include <boost/assert.hpp>
+
+namespace jar {
+
+Action::Ptr
+PluginAction::create(Plugin::Ptr plugin, Timeout timeout /*= kDefaultTimeout*/)
+{
+    BOOST_ASSERT(plugin);
+    return Action::Ptr{new PluginAction{Params{.plugin = std::move(plugin), .timeout = timeout}}};
+}
+
+PluginAction::PluginAction(Params params)
+    : _params{std::move(params)}
+{
+}
+
+Action::Ptr
+PluginAction::clone() const
+{
+    return Action::Ptr{new PluginAction{_params}};
+}
+
+io::awaitable<std::error_code>
+PluginAction::run(io::any_io_executor executor)
+{
+    co_return co_await run(_params, std::move(executor));
+}
+
+io::awaitable<std::error_code>
+PluginAction::run(const Params& params, io::any_io_executor /*executor*/)
+{
+    BOOST_ASSERT(params.plugin);
+    /* The execution is started on the strand of running automation */
+    co_return co_await params.plugin->execute(params.timeout);
+}
+
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,149 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/RateLimiter.hpp"
+
+#include "common/Metrics.hpp"
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+
+namespace jar {
+
+namespace {
+
+struct LimiterMetrics {
+    Gauge& pending{Metrics::instance().gauge("intent.limiter.pending")};
+    Counter& rejected{Metrics::instance().counter("intent.limiter.rejected")};
+    Histogram& wait{Metrics::instance().histogram("intent.limiter.wait_ms",
+                                                  {1, 10, 50, 100, 250, 500, 1000, 5000})};
+};
+
+LimiterMetrics&
+metrics()
+{
+    static LimiterMetrics instance;
+    return instance;
+}
+
+} // namespace
+
+RateLimiter::RateLimiter(Options options)
+    : _options{options}
+    , _tokens{options.burst}
+    , _updated{Clock::now()}
+{
+    BOOST_ASSERT(_options.rate >= 0.0);
+    BOOST_ASSERT(_options.burst >= 1.0);
+}
+
+const RateLimiter::Options&
+RateLimiter::options() const
+{
+    return _options;
+}
+
+bool
+RateLimiter::enabled() const
+{
+    return (_options.rate > 0.0);
+}
+
+std::size_t
+RateLimiter::pending() const
+{
+    std::lock_guard lock{_guard};
+    return _pending;
+}
+
+io::awaitable<bool>
+RateLimiter::acquire(io::cancellation_slot slot /*= {}*/)
+{
+    if (not enabled()) {
+        co_return true;
+    }
+
+    const auto wait = reserve();
+    if (not wait) {
+        LOGW("Reject request exceeding the rate limit");
+        metrics().rejected.increment();
+        co_return false;
+    }
+    metrics().wait.observe(std::chrono::duration<double, std::milli>(*wait).count());
+    if (*wait == Clock::duration::zero()) {
+        co_return true;
+    }
+
+    {
+        std::lock_guard lock{_guard};
+        _pending++;
+    }
+    metrics().pending.increment();
+
+    if (not slot.is_connected()) {
+        /* The waiting is cancelled along with the coroutine itself */
+        slot = (co_await io::this_coro::cancellation_state).slot();
+    }
+    sys::error_code ec;
+    io::steady_timer timer{co_await io::this_coro::executor, *wait};
+    co_await timer.async_wait(
+        io::redirect_error(io::bind_cancellation_slot(slot, io::use_awaitable), ec));
+
+    {
+        std::lock_guard lock{_guard};
+        _pending--;
+    }
+    metrics().pending.decrement();
+
+    if (ec) {
+        /* The waiting is cancelled */
+        refund();
+        throw sys::system_error{ec};
+    }
+    co_return true;
+}
+
+std::optional<RateLimiter::Clock::duration>
+RateLimiter::reserve(Clock::time_point now)
+{
+    std::lock_guard lock{_guard};
+    if (now > _updated) {
+        const double elapsed = std::chrono::duration<double>(now - _updated).count();
+        _tokens = std::min(_tokens + elapsed * _options.rate, _options.burst);
+        _updated = now;
+    }
+
+    /* The tokens might be borrowed from the future by queued requests */
+    const double tokens = _tokens - 1.0;
+    const auto wait = (tokens >= 0.0) ? Clock::duration::zero()
+                                      : std::chrono::duration_cast<Clock::duration>(
+                                          std::chrono::duration<double>(-tokens / _options.rate));
+    if (wait > _options.maxWait) {
+        return std::nullopt;
+    }
+    _tokens = tokens;
+    return wait;
+}
+
+void
+RateLimiter::refund()
+{
+    std::lock_guard lock{_guard};
+    _tokens = std::min(_tokens + 1.0, _options.burst);
+}
+
+} // namespace jar
\ No newline at end of file
@@ -20,16 +20,26 @@
 #include <boost/assert.hpp>
 #include <boost/json.hpp>
 
+#include <array>
+
 namespace json = boost::json;
 
 namespace jar {
 
 namespace {
 
+/* The size of arena holding the DOM of response payload */
+constexpr std::size_t kPayloadArenaSize{512};
+
+/* The time the client exceeding the rate limit is asked to retry after */
+constexpr std::chrono::seconds kRateLimitedRetryAfter{1};
+
 std::string
 getPayload(const RecognitionResult& /*result*/)
 {
-    json::value value;
+    std::array<unsigned char, kPayloadArenaSize> buffer;
+    json::monotonic_resource arena{buffer.data(), buffer.size()};
+    json::value value{&arena};
     auto& object = value.emplace_object();
     object.emplace("status", true);
     return json::serialize(value);
@@ -38,7 +48,9 @@ getPayload(const RecognitionResult& /*result*/)
 std::string
 getPayload(std::error_code error)
 {
-    json::value value;
+    std::array<unsigned char, kPayloadArenaSize> buffer;
+    json::monotonic_resource arena{buffer.data(), buffer.size()};
+    json::value value{&arena};
     auto& object = value.emplace_object();
     object.emplace("status", false);
     object.emplace("error", error.message());
@@ -82,6 +94,31 @@ RecognitionHandler::handle()
     }
 }
 
+RecognitionHandler&
+RecognitionHandler::select()
+{
+    /* Selecting the handler upfront saves the coroutine frames of passing the request along */
+    RecognitionHandler* handler = this;
+    while (handler->_next and not handler->canHandle()) {
+        handler = handler->_next.get();
+    }
+    return *handler;
+}
+
+bool
+RecognitionHandler::canHandle() const
+{
+    return false;
+}
+
+void
+RecognitionHandler::reset()
+{
+    if (_next) {
+        _next->reset();
+    }
+}
+
 io::awaitable<void>
 RecognitionHandler::sendResponse(const RecognitionResult& result)
 {
@@ -96,6 +133,38 @@ RecognitionHandler::sendResponse(std::error_code ec)
     std::ignore = co_await http::async_write(stream(), response, io::as_tuple(io::use_awaitable));
 }
 
+http::response<http::string_body>
+RecognitionHandler::unavailableResponse(std::chrono::seconds retryAfter)
+{
+    const auto error = std::make_error_code(std::errc::resource_unavailable_try_again);
+    auto response = getResponse(getPayload(error));
+    response.result(http::status::service_unavailable);
+    response.set(http::field::retry_after, std::to_string(retryAfter.count()));
+    return response;
+}
+
+io::awaitable<void>
+RecognitionHandler::sendUnavailable(std::chrono::seconds retryAfter)
+{
+    auto response = unavailableResponse(retryAfter);
+    std::ignore = co_await http::async_write(stream(), response, io::as_tuple(io::use_awaitable));
+}
+
+io::awaitable<void>
+RecognitionHandler::sendRateLimited()
+{
+    auto response = unavailableResponse(kRateLimitedRetryAfter);
+    response.result(http::status::too_many_requests);
+    std::ignore = co_await http::async_write(stream(), response, io::as_tuple(io::use_awaitable));
+}
+
+io::awaitable<void>
+RecognitionHandler::sendPayload(std::string payload)
+{
+    auto response = getResponse(std::move(payload));
+    std::ignore = co_await http::async_write(stream(), response, io::as_tuple(io::use_awaitable));
+}
+
 RecognitionHandler::Stream&
 RecognitionHandler::stream()
 {
@@ -14,51 +14,65 @@
 
 #include "intent/RecognitionMessageHandler.hpp"
 
+#include "common/Errors.hpp"
 #include "common/IRecognitionFactory.hpp"
 #include "intent/Utils.hpp"
 
-#include <boost/asio/experimental/awaitable_operators.hpp>
 #include <boost/assert.hpp>
 
-using namespace boost::asio::experimental::awaitable_operators;
-
 namespace jar {
 
 RecognitionMessageHandler::Ptr
 RecognitionMessageHandler::create(Stream& stream,
                                   Buffer& buffer,
                                   Parser& parser,
+                                  io::any_io_executor backend,
                                   std::shared_ptr<IRecognitionFactory> factory)
 {
-    return Ptr(new RecognitionMessageHandler(stream, buffer, parser, std::move(factory)));
+    return Ptr(new RecognitionMessageHandler(
+        stream, buffer, parser, std::move(backend), std::move(factory)));
 }
 
 RecognitionMessageHandler::RecognitionMessageHandler(Stream& stream,
                                                      Buffer& buffer,
                                                      Parser& parser,
+                                                     io::any_io_executor backend,
                                                      std::shared_ptr<IRecognitionFactory> factory)
     : RecognitionHandler{stream}
     , _buffer{buffer}
     , _parser{parser}
+    , _backend{std::move(backend)}
     , _factory{std::move(factory)}
 {
+    BOOST_ASSERT(_backend);
     BOOST_ASSERT(_factory);
 }
 
 io::awaitable<RecognitionResult>
 RecognitionMessageHandler::handle()
 {
-    static const std::size_t kChannelCapacity = 64;
-
     if (not canHandle()) {
         co_return co_await RecognitionHandler::handle();
     }
 
-    auto executor = co_await io::this_coro::executor;
-    auto channel = std::make_shared<Channel>(executor, kChannelCapacity);
-    auto recognition = _factory->message(executor, channel);
+    /* The recognition is run by backend and the result is handed back to the session */
+    io::any_io_executor executor = io::make_strand(_backend);
+    auto recognition = _factory->message(executor, takeMessage());
     BOOST_ASSERT(recognition);
-    auto result = co_await (sendMessageData(channel) && recognition->run());
+    RecognitionResult result;
+    bool limited{false};
+    try {
+        result = co_await io::co_spawn(executor, recognition->run(), io::use_awaitable);
+    } catch (const sys::system_error& e) {
+        if (e.code() != RecognitionErrc::RateLimited) {
+            throw;
+        }
+        limited = true;
+    }
+    if (limited) {
+        co_await sendRateLimited();
+        co_return RecognitionResult{};
+    }
     co_await sendResponse(result);
     co_return std::move(result);
 }
@@ -69,17 +83,14 @@ RecognitionMessageHandler::canHandle() const
     return parser::isMessageTarget(_parser.get().target());
 }
 
-io::awaitable<void>
-RecognitionMessageHandler::sendMessageData(std::shared_ptr<Channel> channel)
+std::string
+RecognitionMessageHandler::takeMessage()
 {
     const auto request = _parser.release();
     if (auto messageOpt = parser::peekMessage(request.target()); messageOpt) {
-        std::ignore = co_await channel->send(io::buffer(*messageOpt));
-        co_await channel->send(io::error::eof);
-        channel->close();
-    } else {
-        throw std::runtime_error{"Missing message in request target"};
+        return std::move(*messageOpt);
     }
+    throw std::runtime_error{"Missing message in request target"};
 }
 
 } // namespace jar
\ No newline at end of file
@@ -0,0 +1,97 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/RecognitionMetricsHandler.hpp"
+
+#include "common/Metrics.hpp"
+#include "intent/Utils.hpp"
+
+#include <boost/json.hpp>
+
+namespace json = boost::json;
+
+namespace jar {
+
+namespace {
+
+std::string
+getPayload(const Metrics::Snapshot& snapshot)
+{
+    json::object counters;
+    for (const auto& [name, value] : snapshot.counters) {
+        counters.emplace(name, value);
+    }
+    json::object gauges;
+    for (const auto& [name, value] : snapshot.gauges) {
+        gauges.emplace(name, value);
+    }
+    json::object histograms;
+    for (const auto& [name, histogram] : snapshot.histograms) {
+        json::array buckets;
+        for (std::size_t n = 0; n < histogram.counts.size(); ++n) {
+            json::object bucket;
+            if (n < histogram.bounds.size()) {
+                bucket.emplace("le", histogram.bounds[n]);
+            } else {
+                bucket.emplace("le", "+Inf");
+            }
+            bucket.emplace("count", histogram.counts[n]);
+            buckets.push_back(std::move(bucket));
+        }
+        json::object object;
+        object.emplace("count", histogram.count);
+        object.emplace("sum", histogram.sum);
+        object.emplace("buckets", std::move(buckets));
+        histograms.emplace(name, std::move(object));
+    }
+
+    json::object object;
+    object.emplace("counters", std::move(counters));
+    object.emplace("gauges", std::move(gauges));
+    object.emplace("histograms", std::move(histograms));
+    return json::serialize(object);
+}
+
+} // namespace
+
+RecognitionMetricsHandler::Ptr
+RecognitionMetricsHandler::create(Stream& stream, Parser& parser)
+{
+    return Ptr(new RecognitionMetricsHandler(stream, parser));
+}
+
+RecognitionMetricsHandler::RecognitionMetricsHandler(Stream& stream, Parser& parser)
+    : RecognitionHandler{stream}
+    , _parser{parser}
+{
+}
+
+io::awaitable<RecognitionResult>
+RecognitionMetricsHandler::handle()
+{
+    if (not canHandle()) {
+        co_return co_await RecognitionHandler::handle();
+    }
+
+    co_await sendPayload(getPayload(Metrics::instance().snapshot()));
+    co_return RecognitionResult{};
+}
+
+bool
+RecognitionMetricsHandler::canHandle() const
+{
+    return parser::isMetricsTarget(_parser.get().target());
+}
+
+} // namespace jar
\ No newline at end of file
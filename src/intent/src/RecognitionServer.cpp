@@ -16,11 +16,14 @@
 
 #include "common/IRecognitionFactory.hpp"
 #include "intent/AutomationPerformer.hpp"
+#include "intent/RecognitionHandler.hpp"
 #include "intent/RecognitionSession.hpp"
 
 #include <jarvisto/core/Logger.hpp>
+#include <jarvisto/network/Http.hpp>
 
 #include <functional>
+#include <utility>
 
 namespace std {
 
@@ -57,50 +60,117 @@ namespace jar {
 std::shared_ptr<RecognitionServer>
 RecognitionServer::create(io::any_io_executor executor,
                           std::shared_ptr<IRecognitionFactory> factory,
-                          std::shared_ptr<AutomationPerformer> performer)
+                          std::shared_ptr<AutomationPerformer> performer,
+                          SessionOptions options,
+                          AdmissionController::Options admission,
+                          io::any_io_executor backend)
 {
-    return Ptr(
-        new RecognitionServer{std::move(executor), std::move(factory), std::move(performer)});
+    return Ptr(new RecognitionServer{std::move(executor),
+                                     std::move(factory),
+                                     std::move(performer),
+                                     options,
+                                     admission,
+                                     std::move(backend)});
 }
 
 RecognitionServer::RecognitionServer(io::any_io_executor executor,
                                      std::shared_ptr<IRecognitionFactory> factory,
-                                     std::shared_ptr<AutomationPerformer> performer)
+                                     std::shared_ptr<AutomationPerformer> performer,
+                                     SessionOptions options,
+                                     AdmissionController::Options admission,
+                                     io::any_io_executor backend)
     : _executor{std::move(executor)}
+    , _backend{backend ? std::move(backend) : _executor}
     , _factory{std::move(factory)}
     , _performer{std::move(performer)}
+    , _options{options}
+    , _admission{AdmissionController::create(admission)}
+    , _memory{ChannelMemoryPool::create(options.speechChannelBudget)}
 {
+    if (options.speechFixedBuffers > 0) {
+        _buffers = FixedBufferPool::create(
+            _executor, options.speechFixedBuffers, options.speechFixedBufferSize);
+    }
+
+    _sessions = SessionPool::create(
+        options.sessionPoolSize,
+        [executor = _executor,
+         backend = _backend,
+         factory = _factory,
+         performer = _performer,
+         admission = _admission,
+         memory = _memory,
+         buffers = _buffers,
+         options](RecognitionSession::Recycler recycler) {
+            return RecognitionSession::create(executor,
+                                              backend,
+                                              factory,
+                                              performer,
+                                              admission,
+                                              memory,
+                                              buffers,
+                                              options,
+                                              std::move(recycler));
+        });
 }
 
-void
+tcp::endpoint
 RecognitionServer::listen(io::ip::port_type port)
 {
     return listen(tcp::endpoint{tcp::v4(), port});
 }
 
-void
+tcp::endpoint
 RecognitionServer::listen(const tcp::endpoint& endpoint)
 {
+    /* The acceptor is bound right away to accept connections once listen is returned */
+    tcp::acceptor acceptor{_executor, endpoint};
+    auto localEndpoint = acceptor.local_endpoint();
     io::co_spawn(
         _executor,
-        [self = shared_from_this(), endpoint]() -> io::awaitable<void> {
-            co_await self->doListen(endpoint);
-        },
+        [self = shared_from_this(), acceptor = std::move(acceptor)]() mutable
+            -> io::awaitable<void> { co_await self->doListen(std::move(acceptor)); },
         io::detached);
+    return localEndpoint;
 }
 
 io::awaitable<void>
-RecognitionServer::doListen(tcp::endpoint endpoint)
+RecognitionServer::doListen(tcp::acceptor acceptor)
 {
-    tcp::acceptor acceptor{co_await io::this_coro::executor, endpoint};
+    RecognitionSession::Ptr session;
     for (;;) {
-        auto socket = co_await acceptor.async_accept(io::use_awaitable);
+        /* The connection is accepted on the strand of session serving it (the session is
+           kept for the next connection if the current one is rejected) */
+        if (not session) {
+            session = _sessions->acquire();
+        }
+        auto socket = co_await acceptor.async_accept(session->executor(), io::use_awaitable);
+        auto ticket = _admission->tryAdmit(AdmissionController::Kind::Session);
+        if (not ticket) {
+            const auto retryAfter = _admission->options().retryAfter;
+            io::co_spawn(
+                socket.get_executor(), doReject(std::move(socket), retryAfter), io::detached);
+            continue;
+        }
         if (auto id = getSessionId(socket); id) {
-            RecognitionSession::create(*id, std::move(socket), _factory, _performer)->run();
+            std::exchange(session, {})->run(*id, std::move(socket), std::move(ticket));
         } else {
             LOGE("Unable to generate session id");
         }
     }
 }
 
+io::awaitable<void>
+RecognitionServer::doReject(tcp::socket socket, std::chrono::seconds retryAfter)
+{
+    static const std::chrono::seconds kTimeout{5};
+
+    beast::tcp_stream stream{std::move(socket)};
+    stream.expires_after(kTimeout);
+    auto response = RecognitionHandler::unavailableResponse(retryAfter);
+    std::ignore = co_await http::async_write(stream, response, io::as_tuple(io::use_awaitable));
+    sys::error_code ec;
+    stream.socket().shutdown(tcp::socket::shutdown_send, ec);
+}
+
 } // namespace jar
\ No newline at end of file
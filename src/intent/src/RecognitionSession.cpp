@@ -16,41 +16,74 @@
 
 #include "common/Formatters.hpp"
 #include "common/IRecognitionFactory.hpp"
+#include "common/Logging.hpp"
 #include "intent/AutomationPerformer.hpp"
 #include "intent/RecognitionMessageHandler.hpp"
+#include "intent/RecognitionMetricsHandler.hpp"
 #include "intent/RecognitionSpeechHandler.hpp"
 #include "intent/RecognitionTerminalHandler.hpp"
 
-#include <jarvisto/core/Logger.hpp>
-
 #include <boost/assert.hpp>
 
 #include <exception>
+#include <memory>
+#include <tuple>
 
 namespace jar {
 
 RecognitionSession::Ptr
-RecognitionSession::create(std::size_t id,
-                           tcp::socket&& socket,
+RecognitionSession::create(io::any_io_executor executor,
+                           io::any_io_executor backend,
                            std::shared_ptr<IRecognitionFactory> factory,
-                           std::shared_ptr<AutomationPerformer> performer)
+                           std::shared_ptr<AutomationPerformer> performer,
+                           std::shared_ptr<AdmissionController> admission,
+                           std::shared_ptr<ChannelMemoryPool> memory,
+                           std::shared_ptr<FixedBufferPool> buffers,
+                           SessionOptions options,
+                           Recycler recycler)
 {
-    return Ptr(
-        new RecognitionSession{id, std::move(socket), std::move(factory), std::move(performer)});
+    return Ptr(new RecognitionSession{std::move(executor),
+                                      std::move(backend),
+                                      std::move(factory),
+                                      std::move(performer),
+                                      std::move(admission),
+                                      std::move(memory),
+                                      std::move(buffers),
+                                      options,
+                                      std::move(recycler)});
 }
 
-RecognitionSession::RecognitionSession(std::size_t id,
-                                       tcp::socket&& socket,
+RecognitionSession::RecognitionSession(io::any_io_executor executor,
+                                       io::any_io_executor backend,
                                        std::shared_ptr<IRecognitionFactory> factory,
-                                       std::shared_ptr<AutomationPerformer> performer)
-    : _id{id}
-    , _stream{std::move(socket)}
+                                       std::shared_ptr<AutomationPerformer> performer,
+                                       std::shared_ptr<AdmissionController> admission,
+                                       std::shared_ptr<ChannelMemoryPool> memory,
+                                       std::shared_ptr<FixedBufferPool> buffers,
+                                       SessionOptions options,
+                                       Recycler recycler)
+    : _stream{io::make_strand(std::move(executor))}
+    , _arena{_arenaBuffer.data(), _arenaBuffer.size()}
+    , _parser{std::piecewise_construct,
+              std::make_tuple(),
+              std::make_tuple(RecognitionHandler::Allocator{&_arena})}
+    , _backend{std::move(backend)}
     , _factory{std::move(factory)}
     , _performer{std::move(performer)}
+    , _admission{std::move(admission)}
+    , _memory{std::move(memory)}
+    , _buffers{std::move(buffers)}
+    , _options{options}
+    , _recycler{std::move(recycler)}
 {
-    BOOST_ASSERT(_id);
+    BOOST_ASSERT(_backend);
     BOOST_ASSERT(_factory);
     BOOST_ASSERT(_performer);
+    BOOST_ASSERT(_admission);
+    BOOST_ASSERT(_memory);
+
+    /* The chain of handlers is built once and reused by all served connections */
+    _handler = createHandler();
 }
 
 std::size_t
@@ -59,23 +92,36 @@ RecognitionSession::id() const
     return _id;
 }
 
+io::any_io_executor
+RecognitionSession::executor()
+{
+    return _stream.get_executor();
+}
+
 void
-RecognitionSession::run()
+RecognitionSession::run(std::size_t id, tcp::socket&& socket, AdmissionController::Ticket ticket)
 {
+    BOOST_ASSERT(id);
+    _id = id;
+    BOOST_ASSERT(socket.get_executor() == _stream.get_executor());
+    _stream.socket() = std::move(socket);
+    _ticket = std::move(ticket);
+
     io::co_spawn(
         _stream.get_executor(),
         [self = shared_from_this()]() {
             LOGD("Run <{}> session", self->id());
             return self->doRun();
         },
-        [id = _id](const std::exception_ptr& eptr) {
+        [self = shared_from_this()](const std::exception_ptr& eptr) {
             try {
                 if (eptr) {
                     std::rethrow_exception(eptr);
                 }
             } catch (const std::exception& e) {
-                LOGE("Unable to run <{}> session: {}", id, e.what());
+                LOGE("Unable to run <{}> session: {}", self->id(), e.what());
             }
+            self->recycle();
         });
 }
 
@@ -86,9 +132,7 @@ RecognitionSession::doRun()
     std::size_t n = co_await http::async_read_header(_stream, _buffer, _parser, io::use_awaitable);
     LOGD("Reading request header was done: session<{}>, transferred<{}>", _id, n);
 
-    auto handler = getHandler();
-    BOOST_ASSERT(handler);
-    auto result = co_await handler->handle();
+    auto result = co_await _handler->select().handle();
     LOGD("Running <{}> session was complete with <{}> result", _id, result);
     if (result) {
         _performer->perform(result);
@@ -96,14 +140,43 @@ RecognitionSession::doRun()
 }
 
 std::shared_ptr<RecognitionHandler>
-RecognitionSession::getHandler()
+RecognitionSession::createHandler()
 {
-    auto handler1 = RecognitionMessageHandler::create(_stream, _buffer, _parser, _factory);
-    auto handler2 = RecognitionSpeechHandler::create(_stream, _buffer, _parser, _factory);
+    auto handler0 = RecognitionMetricsHandler::create(_stream, _parser);
+    auto handler1
+        = RecognitionMessageHandler::create(_stream, _buffer, _parser, _backend, _factory);
+    auto handler2 = RecognitionSpeechHandler::create(
+        _stream, _buffer, _parser, _backend, _factory, _admission, _memory, _buffers, _options);
     auto handler3 = RecognitionTerminalHandler::create(_stream);
     handler2->setNext(std::move(handler3));
     handler1->setNext(std::move(handler2));
-    return handler1;
+    handler0->setNext(std::move(handler1));
+    return handler0;
+}
+
+void
+RecognitionSession::recycle()
+{
+    sys::error_code ec;
+    _stream.socket().shutdown(tcp::socket::shutdown_both, ec);
+    _stream.close();
+    _stream.expires_never();
+    _handler->reset();
+    /* The buffer keeps its capacity while the parser is recreated in place (it's not
+       assignable) to keep the references held by handlers valid */
+    _buffer.clear();
+    std::destroy_at(&_parser);
+    _arena.release();
+    std::construct_at(&_parser,
+                      std::piecewise_construct,
+                      std::make_tuple(),
+                      std::make_tuple(RecognitionHandler::Allocator{&_arena}));
+    _ticket = {};
+    _id = 0;
+
+    if (_recycler) {
+        _recycler(shared_from_this());
+    }
 }
 
 } // namespace jar
\ No newline at end of file
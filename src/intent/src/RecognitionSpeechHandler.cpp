@@ -14,66 +14,188 @@
 
 #include "intent/RecognitionSpeechHandler.hpp"
 
+#include "audio/Decoder.hpp"
+#include "common/Errors.hpp"
 #include "common/IRecognitionFactory.hpp"
+#include "common/Logging.hpp"
+#include "common/Metrics.hpp"
+#include "intent/FixedBufferReader.hpp"
 #include "intent/Utils.hpp"
 
-#include <jarvisto/core/Logger.hpp>
 #include <jarvisto/network/Http.hpp>
 
 #include <boost/asio/experimental/awaitable_operators.hpp>
 #include <boost/assert.hpp>
 
+#include <optional>
+#include <system_error>
+
 using namespace boost::asio::experimental::awaitable_operators;
 
 namespace jar {
 
+namespace {
+
+/* The size of chunk used to replay captured speech data */
+constexpr std::size_t kReplayChunkSize{16 * 1024};
+
+} // namespace
+
 RecognitionSpeechHandler::Ptr
 RecognitionSpeechHandler::create(Stream& stream,
                                  Buffer& buffer,
                                  Parser& parser,
-                                 std::shared_ptr<IRecognitionFactory> factory)
+                                 io::any_io_executor backend,
+                                 std::shared_ptr<IRecognitionFactory> factory,
+                                 std::shared_ptr<AdmissionController> admission,
+                                 std::shared_ptr<ChannelMemoryPool> memory,
+                                 std::shared_ptr<FixedBufferPool> buffers,
+                                 SessionOptions options)
 {
-    return Ptr(new RecognitionSpeechHandler(stream, buffer, parser, std::move(factory)));
+    return Ptr(new RecognitionSpeechHandler(stream,
+                                            buffer,
+                                            parser,
+                                            std::move(backend),
+                                            std::move(factory),
+                                            std::move(admission),
+                                            std::move(memory),
+                                            std::move(buffers),
+                                            options));
 }
 
 RecognitionSpeechHandler::RecognitionSpeechHandler(Stream& stream,
                                                    Buffer& buffer,
                                                    Parser& parser,
-                                                   std::shared_ptr<IRecognitionFactory> factory)
+                                                   io::any_io_executor backend,
+                                                   std::shared_ptr<IRecognitionFactory> factory,
+                                                   std::shared_ptr<AdmissionController> admission,
+                                                   std::shared_ptr<ChannelMemoryPool> memory,
+                                                   std::shared_ptr<FixedBufferPool> buffers,
+                                                   SessionOptions options)
     : RecognitionHandler{stream}
     , _buffer{buffer}
     , _parser{parser}
+    , _backend{std::move(backend)}
     , _factory{std::move(factory)}
+    , _admission{std::move(admission)}
+    , _memory{std::move(memory)}
+    , _buffers{std::move(buffers)}
+    , _options{options}
+    , _capture{options.speechCaptureSize}
 {
+    BOOST_ASSERT(_backend);
     BOOST_ASSERT(_factory);
+    BOOST_ASSERT(_admission);
+    BOOST_ASSERT(_memory);
 }
 
 io::awaitable<RecognitionResult>
 RecognitionSpeechHandler::handle()
 {
-    static const std::size_t kChannelCapacity = 1'000'000 /* 1Mb */;
-
     if (not canHandle()) {
         co_return co_await RecognitionHandler::handle();
     }
 
-    auto executor = co_await io::this_coro::executor;
-    auto channel = std::make_shared<IRecognitionFactory::DataChannel>(executor, kChannelCapacity);
-    auto recognition = _factory->speech(executor, channel);
-    BOOST_ASSERT(recognition);
-    auto result = co_await (sendSpeechData(channel) && recognition->run());
+    auto decoder = createDecoder();
+    if (not decoder) {
+        co_await sendResponse(std::make_error_code(std::errc::not_supported));
+        co_return RecognitionResult{};
+    }
+
+    auto ticket = _admission->tryAdmit(AdmissionController::Kind::Speech);
+    if (not ticket) {
+        co_await sendUnavailable(_admission->options().retryAfter);
+        co_return RecognitionResult{};
+    }
+
+    /* The recognition and its channel are run by backend (the data is handed off to it) */
+    _strand = io::make_strand(_backend);
+    _channel = createChannel(_strand);
+    _recognition = _factory->speech(_strand, _channel);
+    BOOST_ASSERT(_recognition);
+    RecognitionResult result;
+    sys::error_code rejected;
+    try {
+        result = co_await (sendSpeechData(std::move(decoder)) && recognize(_recognition));
+    } catch (const sys::system_error& e) {
+        observeChannel(_channel);
+        if (e.code() == beast::error::timeout) {
+            /* The backend is considered overloaded */
+            ticket.complete(false);
+        }
+        if (e.code() != sys::errc::not_enough_memory and e.code() != RecognitionErrc::RateLimited) {
+            throw;
+        }
+        rejected = e.code();
+    }
+    if (rejected == RecognitionErrc::RateLimited) {
+        co_await sendRateLimited();
+        co_return RecognitionResult{};
+    }
+    if (rejected) {
+        /* The memory of speech channels is exhausted (the client might retry later) */
+        co_await sendUnavailable(_admission->options().retryAfter);
+        co_return RecognitionResult{};
+    }
+    observeChannel(_channel);
+    /* The latency of backend is measured since the end of speech data (not the upload) */
+    ticket.complete(true, _speechEnded);
     co_await sendResponse(result);
     co_return std::move(result);
 }
 
+void
+RecognitionSpeechHandler::reset()
+{
+    _capture.reset();
+    _channel.reset();
+    _recognition.reset();
+    _speechEnded = {};
+    _strand = {};
+    _replaying = false;
+    RecognitionHandler::reset();
+}
+
 bool
 RecognitionSpeechHandler::canHandle() const
 {
     return parser::isSpeechTarget(_parser.get().target());
 }
 
+std::unique_ptr<audio::Decoder>
+RecognitionSpeechHandler::createDecoder() const
+{
+    const auto contentType = _parser.get()[http::field::content_type];
+    const auto format = audio::parseContentType(contentType);
+    if (not format) {
+        LOGE("Unsupported speech content type: <{}>", std::string_view{contentType});
+        return {};
+    }
+    auto decoder = audio::Decoder::create(*format);
+    if (not decoder) {
+        LOGE("Unsupported speech codec: <{}>", std::string_view{contentType});
+    }
+    return decoder;
+}
+
+io::awaitable<void>
+RecognitionSpeechHandler::sendSpeechData(std::unique_ptr<audio::Decoder> decoder)
+{
+    static Counter& aborts = Metrics::instance().counter("intent.speech.aborts");
+
+    try {
+        co_await readSpeechData(std::move(decoder));
+    } catch (const std::exception& e) {
+        /* The truncated speech must be neither recognized nor acted on */
+        LOGW("Cancel speech recognition upon client failure: {}", e.what());
+        aborts.increment();
+        cancelRecognition();
+        throw;
+    }
+}
+
 io::awaitable<void>
-RecognitionSpeechHandler::sendSpeechData(std::shared_ptr<Channel> channel)
+RecognitionSpeechHandler::readSpeechData(std::unique_ptr<audio::Decoder> decoder)
 {
     if (auto& request = _parser.get(); request[http::field::expect] != "100-continue") {
         LOGE("100-continue is expected: session");
@@ -99,25 +221,231 @@ RecognitionSpeechHandler::sendSpeechData(std::shared_ptr<Channel> channel)
     _parser.on_chunk_header(onHeader);
     _parser.on_chunk_body(onBody);
 
+    /* The speech data is read into fixed buffer if there is free one */
+    std::optional<FixedBufferReader> reader;
+    if (_buffers) {
+        if (auto lease = _buffers->acquire(); FixedBufferReader::canTakeOver(lease, _buffer)) {
+            reader.emplace(std::move(lease), _buffer);
+        }
+    }
+
+    std::string data;
     sys::error_code ec;
     while (not _parser.is_done()) {
-        co_await http::async_read(
-            stream(), _buffer, _parser, io::redirect_error(io::use_awaitable, ec));
+        if (reader) {
+            ec = co_await reader->read(stream().socket(), _parser);
+        } else {
+            co_await http::async_read(
+                stream(), _buffer, _parser, io::redirect_error(io::use_awaitable, ec));
+        }
         if (not ec) {
             continue;
         } else {
             if (ec != http::error::end_of_chunk) {
                 LOGE("Error receiving speech data: error<{}>", ec.message());
-                break;
+                throw sys::system_error{io::error::connection_aborted};
             } else {
                 ec = {};
             }
         }
-        co_await channel->send(io::buffer(chunk));
+        data.clear();
+        if (auto error = decoder->decode(chunk, data); error) {
+            LOGE("Error decoding speech data: error<{}>", error.message());
+            throw std::system_error{error, "Unable to decode speech data"};
+        }
+        if (not data.empty()) {
+            co_await sendSpeechChunk(data);
+        }
     }
 
-    co_await channel->send(io::error::eof);
-    channel->close();
+    data.clear();
+    if (auto error = decoder->finalize(data); error) {
+        LOGE("Error finalizing speech data: error<{}>", error.message());
+    } else if (not data.empty()) {
+        co_await sendSpeechChunk(data);
+    }
+
+    co_await sendSpeechEnd();
+}
+
+io::awaitable<void>
+RecognitionSpeechHandler::sendSpeechChunk(std::string_view data)
+{
+    _capture.write(data);
+    if (_replaying) {
+        /* The data will be sent by replaying the capture */
+        co_return;
+    }
+    auto channel = _channel;
+    if (const auto result = co_await sendToChannel(channel, io::buffer(data)); result.error) {
+        if (result.error == sys::errc::not_enough_memory) {
+            /* The speech data must not be dropped in the middle of utterance */
+            LOGE("Unable to send speech data: memory of speech channels is exhausted");
+            throw sys::system_error{result.error};
+        }
+        /* The data is still captured to be replayed upon retry */
+        LOGD("Unable to send speech data: error<{}>", result.error.message());
+    }
+}
+
+io::awaitable<void>
+RecognitionSpeechHandler::sendSpeechEnd()
+{
+    _capture.complete();
+    _speechEnded = AdmissionController::Clock::now();
+    if (_replaying) {
+        /* The end of data will be sent upon the end of replaying */
+        co_return;
+    }
+    auto channel = _channel;
+    co_await sendToChannel(channel, io::error::eof);
+    closeChannel(channel);
+}
+
+io::awaitable<RecognitionResult>
+RecognitionSpeechHandler::recognize(std::shared_ptr<Recognition> recognition)
+{
+    static Counter& retries = Metrics::instance().counter("intent.speech.retries");
+
+    std::shared_ptr<Channel> replayChannel;
+    for (std::size_t attempt = 0;; ++attempt) {
+        sys::error_code error;
+        try {
+            if (replayChannel) {
+                co_return co_await (replaySpeechData(replayChannel)
+                                    && runRecognition(recognition));
+            } else {
+                co_return co_await runRecognition(recognition);
+            }
+        } catch (const sys::system_error& e) {
+            if (not canRetry(e.code(), attempt)) {
+                throw;
+            }
+            error = e.code();
+        }
+
+        LOGW("Retry speech recognition: attempt<{}>, error<{}>", attempt + 1, error.message());
+        retries.increment();
+
+        /* Unblock sending the data into the channel of failed recognition */
+        _replaying = true;
+        closeChannel(_channel);
+
+        observeChannel(_channel);
+        replayChannel = createChannel(_strand);
+        recognition = _factory->speech(_strand, replayChannel);
+        BOOST_ASSERT(recognition);
+        _recognition = recognition;
+    }
+}
+
+io::awaitable<void>
+RecognitionSpeechHandler::replaySpeechData(std::shared_ptr<Channel> channel)
+{
+    LOGD("Replay captured speech data: size<{}>", _capture.size());
+
+    std::string chunk;
+    std::size_t offset{};
+    while (offset < _capture.size()) {
+        if (_capture.overflowed()) {
+            throw std::runtime_error{"Speech capture is overflowed during replay"};
+        }
+        chunk.clear();
+        offset += _capture.read(offset, chunk, kReplayChunkSize);
+        if (const auto result = co_await sendToChannel(channel, io::buffer(chunk)); result.error) {
+            throw sys::system_error{result.error};
+        }
+    }
+
+    /* Continue sending the live data using the new channel */
+    _channel = channel;
+    _replaying = false;
+    if (_capture.completed()) {
+        co_await sendToChannel(channel, io::error::eof);
+        closeChannel(channel);
+    }
+
+    LOGD("Replaying captured speech data was done: size<{}>", offset);
+}
+
+std::shared_ptr<RecognitionSpeechHandler::Channel>
+RecognitionSpeechHandler::createChannel(const io::any_io_executor& executor) const
+{
+    /* The memory of channel is taken from the shared pool as the data comes */
+    return std::make_shared<Channel>(executor, _options.speechChannelCapacity, _memory.get());
+}
+
+io::awaitable<RecognitionResult>
+RecognitionSpeechHandler::runRecognition(std::shared_ptr<Recognition> recognition)
+{
+    /* The session is resumed upon the recognition run by backend is done */
+    co_return co_await io::co_spawn(_strand, recognition->run(), io::use_awaitable);
+}
+
+io::awaitable<RecognitionSpeechHandler::Channel::Result>
+RecognitionSpeechHandler::sendToChannel(std::shared_ptr<Channel> channel, io::const_buffer data)
+{
+    const auto executor = channel->executor();
+    co_return co_await io::co_spawn(executor, channel->send(data), io::use_awaitable);
+}
+
+io::awaitable<void>
+RecognitionSpeechHandler::sendToChannel(std::shared_ptr<Channel> channel, sys::error_code status)
+{
+    const auto executor = channel->executor();
+    co_await io::co_spawn(executor, channel->send(status), io::use_awaitable);
+}
+
+void
+RecognitionSpeechHandler::closeChannel(std::shared_ptr<Channel> channel)
+{
+    const auto executor = channel->executor();
+    io::dispatch(executor, [channel = std::move(channel)]() { channel->close(); });
+}
+
+void
+RecognitionSpeechHandler::observeChannel(std::shared_ptr<Channel> channel)
+{
+    static Histogram& highWater = Metrics::instance().histogram(
+        "intent.speech.channel_high_water", {4096, 16384, 65536, 262144, 1048576});
+
+    const auto executor = channel->executor();
+    io::dispatch(executor, [channel = std::move(channel)]() {
+        highWater.observe(static_cast<double>(channel->highWater()));
+    });
+}
+
+void
+RecognitionSpeechHandler::cancelRecognition()
+{
+    if (not _strand) {
+        return;
+    }
+    io::dispatch(_strand, [channel = _channel, recognition = _recognition]() {
+        if (channel) {
+            channel->close();
+        }
+        if (recognition) {
+            recognition->cancel();
+        }
+    });
+}
+
+bool
+RecognitionSpeechHandler::canRetry(const sys::error_code& ec, std::size_t attempt) const
+{
+    static Counter& overflows = Metrics::instance().counter("intent.speech.capture_overflows");
+
+    if (not isRetryable(ec) or attempt >= _options.speechRetries) {
+        return false;
+    }
+    if (_capture.overflowed()) {
+        LOGW("Unable to retry since speech capture is overflowed: capacity<{}>",
+             _options.speechCaptureSize);
+        overflows.increment();
+        return false;
+    }
+    return true;
 }
 
 } // namespace jar
\ No newline at end of file
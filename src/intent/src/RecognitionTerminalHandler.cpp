@@ -31,6 +31,12 @@ RecognitionTerminalHandler::RecognitionTerminalHandler(Stream& stream)
 {
 }
 
+bool
+RecognitionTerminalHandler::canHandle() const
+{
+    return true;
+}
+
 io::awaitable<RecognitionResult>
 RecognitionTerminalHandler::handle()
 {
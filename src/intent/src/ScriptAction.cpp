@@ -14,6 +14,9 @@
 
 #include "intent/ScriptAction.hpp"
 
+#include "intent/ScriptLauncher.hpp"
+
+#include <boost/asio/experimental/awaitable_operators.hpp>
 #include <boost/assert.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/optional.hpp>
@@ -22,10 +25,16 @@
 #include <jarvisto/core/Logger.hpp>
 
 #include <chrono>
+#include <string_view>
+#include <variant>
+
+#include <unistd.h>
 
 namespace fs = std::filesystem;
 namespace pr = boost::process::v2;
 
+using namespace boost::asio::experimental::awaitable_operators;
+
 namespace jar {
 
 Action::Ptr
@@ -37,135 +46,176 @@ ScriptAction::create(std::filesystem::path exec,
                      Timeout timeout /*= kDefaultTimeout*/)
 {
     BOOST_ASSERT(not exec.empty());
-    return Action::Ptr{new ScriptAction{std::move(exec),
-                                        std::move(args),
-                                        std::move(home),
-                                        std::move(env),
-                                        inheritParentEnv,
-                                        timeout}};
+    Params params{.exec = std::move(exec),
+                  .args = std::move(args),
+                  .home = std::move(home),
+                  .env = std::move(env),
+                  .inheritParentEnv = inheritParentEnv,
+                  .timeout = timeout,
+                  .plan = {}};
+    /* The error is reported upon run */
+    std::ignore = compile(params);
+    return Action::Ptr{new ScriptAction{std::move(params)}};
 }
 
-ScriptAction::ScriptAction(std::filesystem::path exec,
-                           Args args /*= {}*/,
-                           std::filesystem::path home /*= {}*/,
-                           Environment env /*= {}*/,
-                           bool inheritParentEnv /*= false*/,
-                           Timeout timeout /*= kDefaultTimeout*/)
-    : _exec{std::move(exec)}
-    , _args{std::move(args)}
-    , _home{std::move(home)}
-    , _env{std::move(env)}
-    , _inheritParentEnv{inheritParentEnv}
-    , _timeout{timeout}
+ScriptAction::ScriptAction(Params params)
+    : _params{std::move(params)}
 {
 }
 
 ScriptAction::Ptr
 ScriptAction::clone() const
 {
-    return Action::Ptr{new ScriptAction{_exec, _args, _home, _env, _inheritParentEnv, _timeout}};
+    return Action::Ptr{new ScriptAction{_params}};
 }
 
-void
-ScriptAction::execute(io::any_io_executor executor)
+io::awaitable<std::error_code>
+ScriptAction::run(io::any_io_executor executor)
 {
-    _executor = std::move(executor);
+    co_return co_await run(_params, std::move(executor));
+}
 
-    io::post(_executor, [weakSelf = weak_from_this()]() {
-        if (auto self = weakSelf.lock()) {
-            self->run();
-        }
-    });
+std::error_code
+ScriptAction::compile(Params& params)
+{
+    std::error_code ec;
+    params.plan = makePlan(params, ec);
+    return ec;
 }
 
-void
-ScriptAction::run()
+std::shared_ptr<const ScriptAction::Plan>
+ScriptAction::makePlan(const Params& params, std::error_code& ec)
 {
-    _exec = fs::path{pr::environment::find_executable(_exec).string()};
-    if (_exec.empty()) {
-        LOGE("Unable to locate program executable file");
-        complete(std::make_error_code(std::errc::invalid_argument));
-        return;
-    }
+    auto plan = std::make_shared<Plan>();
 
-    if (_home.empty()) {
-        _home = fs::current_path();
-        LOGD("Use <{}> path as home directory", _home);
+    plan->exec = pr::environment::find_executable(params.exec).string();
+    if (plan->exec.empty()) {
+        LOGE("Unable to locate <{}> program executable file", params.exec);
+        ec = std::make_error_code(std::errc::invalid_argument);
+        return {};
     }
 
-    std::unordered_map<pr::environment::key, pr::environment::value> env;
-    if (_inheritParentEnv) {
-        LOGD("Copy env from current process");
-        for (const auto& keyValueView : pr::environment::current()) {
-            env[keyValueView.key()].assign(keyValueView.value());
-        }
+    plan->home = params.home.empty() ? fs::current_path(ec) : params.home;
+    if (not ec and not fs::is_directory(plan->home, ec) and not ec) {
+        ec = std::make_error_code(std::errc::not_a_directory);
     }
-    if (not _env.empty()) {
-        for (const auto& [name, value] : _env) {
-            env[name].assign(value);
-        }
+    if (ec) {
+        LOGE("Unable to use <{}> path as home directory: {}", plan->home, ec.message());
+        return {};
     }
 
-    auto onComplete = [weakSelf = weak_from_this()](sys::error_code ec, int exitCode) {
-        if (auto self = weakSelf.lock()) {
-            self->cancelTimer();
-            if (ec) {
-                LOGE("Unable to execute program");
-                self->complete(ec);
-            } else {
-                LOGI("Program ended with <{}> exit code", exitCode);
-                self->complete();
+    if (params.inheritParentEnv or not params.env.empty()) {
+        auto& env = plan->env.emplace();
+        if (params.inheritParentEnv) {
+            for (char** entry = environ; *entry != nullptr; ++entry) {
+                const std::string_view keyValue{*entry};
+                if (not params.env.contains(std::string{keyValue.substr(0, keyValue.find('='))})) {
+                    env.emplace_back(keyValue);
+                }
             }
         }
-    };
+        for (const auto& [name, value] : params.env) {
+            env.push_back(name + '=' + value);
+        }
+    }
 
-    // ToDo: Add `process_environment(env)` as an argument when boost::process is updated
-    pr::async_execute(
-        pr::process{
-            _executor,
-            _exec,
-            _args,
-            pr::process_start_dir{_home},
-            pr::process_stdio{nullptr, nullptr, nullptr},
-        },
-        io::bind_cancellation_slot(_runningSig.slot(), std::move(onComplete)));
-
-    scheduleTimer();
+    plan->request = ScriptLauncher::encode(ScriptLauncher::Command{
+        .exec = plan->exec, .args = params.args, .home = plan->home, .env = plan->env});
+    if (plan->request.empty()) {
+        LOGE("Unable to encode <{}> program command", params.exec);
+        ec = std::make_error_code(std::errc::argument_list_too_long);
+        return {};
+    }
+    return plan;
 }
 
-void
-ScriptAction::terminate()
+io::awaitable<std::error_code>
+ScriptAction::run(const Params& params, io::any_io_executor executor)
 {
-    LOGI("Terminate program due to timeout");
-    _runningSig.emit(io::cancellation_type::terminal);
+    std::shared_ptr<const Plan> plan = params.plan;
+    if (not plan) {
+        std::error_code ec;
+        if (plan = makePlan(params, ec); not plan) {
+            co_return ec;
+        }
+    }
+
+    if (auto launcher = ScriptLauncher::installed(); launcher and launcher->alive()) {
+        co_return co_await spawn(params, std::move(plan), std::move(launcher), std::move(executor));
+    }
+    co_return co_await execute(params, std::move(plan), std::move(executor));
 }
 
-void
-ScriptAction::scheduleTimer()
+io::awaitable<std::error_code>
+ScriptAction::spawn(const Params& params,
+                    std::shared_ptr<const Plan> plan,
+                    std::shared_ptr<ScriptLauncher> launcher,
+                    io::any_io_executor executor)
 {
-    namespace krn = std::chrono;
+    /* The program is killed by launcher once the launch is cancelled (e.g. upon timeout) */
+    io::steady_timer timer{executor, params.timeout};
+    auto result = co_await (launcher->launch(plan->request, executor)
+                            || timer.async_wait(io::as_tuple(io::use_awaitable)));
+    if (const auto cs = co_await io::this_coro::cancellation_state;
+        cs.cancelled() != io::cancellation_type::none) {
+        LOGI("Program was terminated upon cancellation");
+        co_return std::make_error_code(std::errc::operation_canceled);
+    }
+    if (result.index() == 1) {
+        LOGI("Terminate program due to timeout");
+        co_return std::make_error_code(std::errc::timed_out);
+    }
 
-    _runningTimer = std::make_unique<io::steady_timer>(_executor, _timeout);
-    _runningTimer->async_wait([weakSelf = weak_from_this()](sys::error_code ec) {
-        if (ec) {
-            if (ec != io::error::operation_aborted) {
-                LOGE("Unable to wait given timeout: error<{}>", ec.message());
-            }
-        } else {
-            if (auto self = weakSelf.lock()) {
-                self->terminate();
-            }
-        }
-    });
+    const auto [ec, exitCode] = std::get<0>(result);
+    if (ec and not launcher->alive()) {
+        LOGW("Launcher is unavailable, execute program directly: error<{}>", ec.message());
+        co_return co_await execute(params, std::move(plan), std::move(executor));
+    }
+    if (ec) {
+        LOGE("Unable to spawn program: error<{}>", ec.message());
+        co_return ec;
+    }
+    LOGI("Program ended with <{}> exit code", exitCode);
+    co_return std::error_code{};
 }
 
-void
-ScriptAction::cancelTimer()
+io::awaitable<std::error_code>
+ScriptAction::execute(const Params& params,
+                      std::shared_ptr<const Plan> plan,
+                      io::any_io_executor executor)
 {
-    if (_runningTimer) {
-        _runningTimer->cancel();
+    // ToDo: Add `process_environment(plan->env)` as an argument when boost::process is updated
+    pr::process process{
+        executor,
+        plan->exec,
+        params.args,
+        pr::process_start_dir{plan->home},
+        pr::process_stdio{nullptr, nullptr, nullptr},
+    };
+
+    /* The program is terminated upon timeout (the loser operation is cancelled) and upon
+       cancellation of awaiting coroutine (the cancellation is forwarded to both) */
+    io::steady_timer timer{executor, params.timeout};
+    auto result = co_await (
+        pr::async_execute(std::move(process), io::as_tuple(io::use_awaitable))
+        || timer.async_wait(io::as_tuple(io::use_awaitable)));
+    if (const auto cs = co_await io::this_coro::cancellation_state;
+        cs.cancelled() != io::cancellation_type::none) {
+        LOGI("Program was terminated upon cancellation");
+        co_return std::make_error_code(std::errc::operation_canceled);
+    }
+    if (result.index() == 1) {
+        LOGI("Terminate program due to timeout");
+        co_return std::make_error_code(std::errc::timed_out);
+    }
+
+    const auto [ec, exitCode] = std::get<0>(result);
+    if (ec) {
+        LOGE("Unable to execute program: error<{}>", ec.message());
+        co_return ec;
     }
-    _runningTimer.reset();
+    LOGI("Program ended with <{}> exit code", exitCode);
+    co_return std::error_code{};
 }
 
-} // namespace jar
+} // namespace jar
\ No newline at end of file
@@ -0,0 +1,469 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/ScriptLauncher.hpp"
+
+#include <boost/assert.hpp>
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <sys/prctl.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace jar {
+
+namespace {
+
+/* The value of environment count telling to inherit the environment of launcher */
+constexpr std::uint32_t kInheritEnv{std::numeric_limits<std::uint32_t>::max()};
+
+struct Header {
+    std::uint32_t argc;
+    std::uint32_t envc;
+};
+
+/* The launcher reports twice: the result of spawn (error or pid) and the exit status */
+struct Reply {
+    std::int32_t error;
+    std::int32_t value;
+};
+
+using Buffer = std::array<char, ScriptLauncher::kMaxCommandSize>;
+
+struct Child {
+    pid_t pid;
+    int reply;
+};
+
+ScriptLauncher::Ptr&
+instance()
+{
+    static ScriptLauncher::Ptr launcher;
+    return launcher;
+}
+
+std::error_code
+lastError()
+{
+    return {errno, std::generic_category()};
+}
+
+void
+append(std::string& request, const std::string& value)
+{
+    request.append(value);
+    request.push_back('\0');
+}
+
+/* Decodes the list of strings in place (the string must be null-terminated within the data) */
+bool
+decode(char* data, std::size_t size, std::size_t count, std::vector<char*>& values)
+{
+    char* const end = data + size;
+    for (std::size_t n = 0; n < count; ++n) {
+        char* const next = std::find(data, end, '\0');
+        if (next == end) {
+            return false;
+        }
+        values.push_back(data);
+        data = next + 1;
+    }
+    return true;
+}
+
+void
+reply(int fd, Reply value)
+{
+    std::ignore = ::send(fd, &value, sizeof(value), MSG_NOSIGNAL);
+}
+
+/* Spawns the program of given request and returns the pid (or the negated error) */
+pid_t
+spawn(char* request, std::size_t size)
+{
+    Header header{};
+    if (size < sizeof(header)) {
+        return -EINVAL;
+    }
+    std::memcpy(&header, request, sizeof(header));
+    request += sizeof(header), size -= sizeof(header);
+
+    const bool inheritEnv = (header.envc == kInheritEnv);
+    const std::size_t count = 2 + header.argc + (inheritEnv ? 0 : header.envc);
+    if (count > size) {
+        return -EINVAL;
+    }
+    std::vector<char*> values;
+    values.reserve(count + 2);
+    if (not decode(request, size, count, values)) {
+        return -EINVAL;
+    }
+
+    const char* home = values[1];
+    std::vector<char*> argv;
+    argv.reserve(header.argc + 2);
+    argv.push_back(values[0]);
+    argv.insert(argv.end(), values.begin() + 2, values.begin() + 2 + header.argc);
+    argv.push_back(nullptr);
+    std::vector<char*> envp;
+    if (not inheritEnv) {
+        envp.assign(values.begin() + 2 + header.argc, values.end());
+        envp.push_back(nullptr);
+    }
+
+    posix_spawn_file_actions_t actions;
+    ::posix_spawn_file_actions_init(&actions);
+    ::posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+    ::posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+    ::posix_spawn_file_actions_addopen(&actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+    if (*home != '\0') {
+        ::posix_spawn_file_actions_addchdir_np(&actions, home);
+    }
+
+    /* The program starts with default mask and disposition of signals changed by launcher */
+    posix_spawnattr_t attr;
+    ::posix_spawnattr_init(&attr);
+    sigset_t mask;
+    sigemptyset(&mask);
+    ::posix_spawnattr_setsigmask(&attr, &mask);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGPIPE);
+    ::posix_spawnattr_setsigdefault(&attr, &mask);
+    ::posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+
+    pid_t pid{};
+    const int error = ::posix_spawnp(
+        &pid, argv[0], &actions, &attr, argv.data(), inheritEnv ? environ : envp.data());
+    ::posix_spawnattr_destroy(&attr);
+    ::posix_spawn_file_actions_destroy(&actions);
+    return (error == 0) ? pid : -error;
+}
+
+/* Reports the exit status of finished programs */
+void
+reap(std::vector<Child>& children)
+{
+    int status{};
+    pid_t pid{};
+    while ((pid = ::waitpid(-1, &status, WNOHANG)) > 0) {
+        const auto it = std::ranges::find(children, pid, &Child::pid);
+        if (it == children.end()) {
+            continue;
+        }
+        if (it->reply >= 0) {
+            const int code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+            reply(it->reply, Reply{.error = 0, .value = code});
+            ::close(it->reply);
+        }
+        children.erase(it);
+    }
+}
+
+/* Receives the request along with the socket to report to (returns false upon hangup) */
+bool
+receive(int control, Buffer& buffer, std::vector<Child>& children)
+{
+    iovec iov{.iov_base = buffer.data(), .iov_len = buffer.size()};
+    alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(int))> data{};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = data.data();
+    msg.msg_controllen = data.size();
+    const ssize_t size = ::recvmsg(control, &msg, MSG_CMSG_CLOEXEC);
+    if (size <= 0) {
+        return (size < 0 and errno == EINTR);
+    }
+
+    int fd{-1};
+    if (const cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg and cmsg->cmsg_level == SOL_SOCKET and cmsg->cmsg_type == SCM_RIGHTS) {
+        std::memcpy(&fd, CMSG_DATA(cmsg), sizeof(fd));
+    }
+    if (fd < 0) {
+        return true;
+    }
+    const pid_t pid = (msg.msg_flags & MSG_TRUNC)
+        ? -E2BIG
+        : spawn(buffer.data(), static_cast<std::size_t>(size));
+    if (pid < 0) {
+        reply(fd, Reply{.error = -pid, .value = 0});
+        ::close(fd);
+        return true;
+    }
+    reply(fd, Reply{.error = 0, .value = pid});
+    children.push_back(Child{.pid = pid, .reply = fd});
+    return true;
+}
+
+[[noreturn]] void
+runLauncher(int control)
+{
+    /* The launcher keeps running upon interrupt from terminal and exits along with service */
+    std::signal(SIGINT, SIG_IGN);
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGCHLD);
+    ::sigprocmask(SIG_BLOCK, &mask, nullptr);
+    const int signals = ::signalfd(-1, &mask, SFD_CLOEXEC);
+
+    auto buffer = std::make_unique<Buffer>();
+    std::vector<Child> children;
+    std::vector<pollfd> fds;
+    while (true) {
+        fds.clear();
+        fds.push_back(pollfd{.fd = control, .events = POLLIN, .revents = 0});
+        fds.push_back(pollfd{.fd = signals, .events = POLLIN, .revents = 0});
+        for (const auto& child : children) {
+            /* The hangup of requester is always reported (the closed socket is ignored) */
+            fds.push_back(pollfd{.fd = child.reply, .events = 0, .revents = 0});
+        }
+        if (::poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        for (std::size_t n = 0; n < children.size(); ++n) {
+            if (fds[n + 2].revents & (POLLHUP | POLLERR)) {
+                ::kill(children[n].pid, SIGKILL);
+                ::close(children[n].reply);
+                children[n].reply = -1;
+            }
+        }
+        if (fds[1].revents & POLLIN) {
+            signalfd_siginfo info{};
+            std::ignore = ::read(signals, &info, sizeof(info));
+            reap(children);
+        }
+        if ((fds[0].revents & (POLLIN | POLLHUP | POLLERR))
+            and not receive(control, *buffer, children)) {
+            break;
+        }
+    }
+
+    for (const auto& child : children) {
+        ::kill(child.pid, SIGKILL);
+    }
+    ::_exit(EXIT_SUCCESS);
+}
+
+} // namespace
+
+ScriptLauncher::Ptr
+ScriptLauncher::create()
+{
+    std::array<int, 2> fds{};
+    if (::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds.data()) < 0) {
+        LOGE("Unable to create launcher socket: {}", lastError().message());
+        return {};
+    }
+
+    const pid_t parent = ::getpid();
+    const pid_t pid = ::fork();
+    if (pid < 0) {
+        LOGE("Unable to fork launcher process: {}", lastError().message());
+        ::close(fds[0]);
+        ::close(fds[1]);
+        return {};
+    }
+    if (pid == 0) {
+        ::close(fds[0]);
+        ::prctl(PR_SET_PDEATHSIG, SIGKILL);
+        if (::getppid() != parent) {
+            ::_exit(EXIT_SUCCESS);
+        }
+        runLauncher(fds[1]);
+    }
+    ::close(fds[1]);
+    return Ptr(new ScriptLauncher{pid, fds[0]});
+}
+
+void
+ScriptLauncher::install(Ptr launcher)
+{
+    instance() = std::move(launcher);
+}
+
+ScriptLauncher::Ptr
+ScriptLauncher::installed()
+{
+    return instance();
+}
+
+ScriptLauncher::ScriptLauncher(pid_t pid, int control)
+    : _pid{pid}
+    , _control{control}
+{
+    BOOST_ASSERT(_pid > 0);
+    BOOST_ASSERT(_control >= 0);
+}
+
+ScriptLauncher::~ScriptLauncher()
+{
+    /* The launcher kills the running programs and exits upon hangup */
+    ::close(_control);
+    ::waitpid(_pid, nullptr, 0);
+}
+
+pid_t
+ScriptLauncher::pid() const
+{
+    return _pid;
+}
+
+bool
+ScriptLauncher::alive() const
+{
+    return _alive;
+}
+
+/* The command is encoded as the header followed by the list of null-terminated strings */
+std::string
+ScriptLauncher::encode(const Command& command)
+{
+    std::string request;
+    const Header header{
+        .argc = static_cast<std::uint32_t>(command.args.size()),
+        .envc = command.env ? static_cast<std::uint32_t>(command.env->size()) : kInheritEnv,
+    };
+    request.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    append(request, command.exec.string());
+    append(request, command.home.string());
+    for (const auto& arg : command.args) {
+        append(request, arg);
+    }
+    if (command.env) {
+        for (const auto& entry : *command.env) {
+            append(request, entry);
+        }
+    }
+    if (request.size() > kMaxCommandSize) {
+        request.clear();
+    }
+    return request;
+}
+
+io::awaitable<std::tuple<std::error_code, int>>
+ScriptLauncher::launch(const Command& command, io::any_io_executor executor)
+{
+    const std::string request = encode(command);
+    if (request.empty()) {
+        co_return std::make_tuple(std::make_error_code(std::errc::argument_list_too_long), 0);
+    }
+    co_return co_await launch(std::string_view{request}, std::move(executor));
+}
+
+io::awaitable<std::tuple<std::error_code, int>>
+ScriptLauncher::launch(std::string_view request, io::any_io_executor executor)
+{
+    BOOST_ASSERT(not request.empty());
+
+    std::array<int, 2> fds{};
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds.data()) < 0) {
+        co_return std::make_tuple(lastError(), 0);
+    }
+    /* The program is killed once this socket is closed */
+    io::local::stream_protocol::socket socket{executor, io::local::stream_protocol{}, fds[0]};
+    const auto ec = co_await send(request, fds[1], executor);
+    ::close(fds[1]);
+    if (ec) {
+        co_return std::make_tuple(ec, 0);
+    }
+
+    Reply spawned{}, exited{};
+    sys::error_code error;
+    co_await io::async_read(socket,
+                            io::buffer(&spawned, sizeof(spawned)),
+                            io::redirect_error(io::use_awaitable, error));
+    if (error) {
+        co_return std::make_tuple(std::error_code{error}, 0);
+    }
+    if (spawned.error != 0) {
+        co_return std::make_tuple(std::error_code{spawned.error, std::generic_category()}, 0);
+    }
+    LOGD("Program was spawned: pid<{}>", spawned.value);
+    co_await io::async_read(socket,
+                            io::buffer(&exited, sizeof(exited)),
+                            io::redirect_error(io::use_awaitable, error));
+    if (error) {
+        co_return std::make_tuple(std::error_code{error}, 0);
+    }
+    co_return std::make_tuple(std::error_code{}, exited.value);
+}
+
+io::awaitable<std::error_code>
+ScriptLauncher::send(std::string_view request, int reply, io::any_io_executor executor)
+{
+    iovec iov{.iov_base = const_cast<char*>(request.data()), .iov_len = request.size()};
+    alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(int))> data{};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = data.data();
+    msg.msg_controllen = data.size();
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(reply));
+    std::memcpy(CMSG_DATA(cmsg), &reply, sizeof(reply));
+
+    /* The message of sequenced packet socket is sent atomically (no need to serialize) */
+    while (::sendmsg(_control, &msg, MSG_NOSIGNAL | MSG_DONTWAIT) < 0) {
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno != EAGAIN and errno != EWOULDBLOCK) {
+            const auto error = lastError();
+            if (error == std::errc::broken_pipe or error == std::errc::connection_reset
+                or error == std::errc::not_connected) {
+                LOGE("Launcher is gone: {}", error.message());
+                _alive = false;
+            }
+            co_return error;
+        }
+
+        /* The launcher is busy (the socket buffer is full), so the socket is waited to be
+           writable using its duplicate (the control socket itself is shared by executors) */
+        const int fd = ::fcntl(_control, F_DUPFD_CLOEXEC, 0);
+        if (fd < 0) {
+            co_return lastError();
+        }
+        io::posix::stream_descriptor descriptor{executor, fd};
+        sys::error_code ec;
+        co_await descriptor.async_wait(io::posix::stream_descriptor::wait_write,
+                                       io::redirect_error(io::use_awaitable, ec));
+        if (ec) {
+            co_return std::error_code{ec};
+        }
+    }
+    co_return std::error_code{};
+}
+
+} // namespace jar
\ No newline at end of file
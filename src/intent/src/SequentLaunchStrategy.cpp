@@ -14,9 +14,7 @@
 
 #include "intent/SequentLaunchStrategy.hpp"
 
-#include <jarvisto/core/Logger.hpp>
-
-#include <boost/assert.hpp>
+#include "common/Logging.hpp"
 
 namespace jar {
 
@@ -26,74 +24,23 @@ SequentLaunchStrategy::clone() const
     return LaunchStrategy::Ptr{new SequentLaunchStrategy(*this)};
 }
 
-void
-SequentLaunchStrategy::launch(io::any_io_executor executor, Action::List actions)
+io::awaitable<std::error_code>
+SequentLaunchStrategy::run(io::any_io_executor executor, std::span<const ActionDef> actions)
 {
     if (actions.empty()) {
         LOGW("Empty actions list");
-        complete(std::make_error_code(std::errc::invalid_argument));
-        return;
+        co_return std::make_error_code(std::errc::invalid_argument);
     }
 
-    _executor = std::move(executor);
-    _actions = std::move(actions);
-
-    executeNextAction();
-}
-
-Action::Ptr
-SequentLaunchStrategy::currentAction() const
-{
-    BOOST_ASSERT(not _actions.empty());
-    return _actions[currentActionIndex()];
-}
-
-std::size_t
-SequentLaunchStrategy::currentActionIndex() const
-{
-    BOOST_ASSERT(_currIndex >= 0);
-    BOOST_ASSERT(_currIndex < _actions.size());
-    return _currIndex;
-}
-
-bool
-SequentLaunchStrategy::hasNextAction() const
-{
-    return (_nextIndex < _actions.size());
-}
-
-void
-SequentLaunchStrategy::executeNextAction()
-{
-    BOOST_ASSERT(_nextIndex < _actions.size());
-    auto nextAction = _actions[_nextIndex];
-    _currIndex = _nextIndex++;
-
-    BOOST_ASSERT(nextAction);
-    nextAction->onComplete([weakSelf = weak_from_this()](const std::error_code ec) {
-        if (auto self = weakSelf.lock()) {
-            self->onActionDone(ec);
-        }
-    });
-
-    LOGI("Execute the <{}> action", currentActionIndex() + 1);
-    nextAction->execute(_executor);
-}
-
-void
-SequentLaunchStrategy::onActionDone(std::error_code ec)
-{
-    LOGI("Executing the <{}> action is done: result<{}>", currentActionIndex() + 1, ec.message());
-
-    if (ec) {
-        complete(ec);
-    } else {
-        if (hasNextAction()) {
-            executeNextAction();
-        } else {
-            complete();
+    for (std::size_t index = 0; index < actions.size(); ++index) {
+        LOGI("Execute the <{}> action", index + 1);
+        const auto ec = co_await runAction(actions[index], executor);
+        LOGI("Executing the <{}> action is done: result<{}>", index + 1, ec.message());
+        if (ec) {
+            co_return ec;
         }
     }
+    co_return std::error_code{};
 }
 
 } // namespace jar
\ No newline at end of file
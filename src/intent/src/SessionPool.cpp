@@ -0,0 +1,126 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/SessionPool.hpp"
+
+#include "common/Metrics.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace jar {
+
+namespace {
+
+struct PoolMetrics {
+    Counter& hits{Metrics::instance().counter("intent.session.pool_hits")};
+    Counter& misses{Metrics::instance().counter("intent.session.pool_misses")};
+    Gauge& idle{Metrics::instance().gauge("intent.session.pool_idle")};
+};
+
+PoolMetrics&
+metrics()
+{
+    static PoolMetrics instance;
+    return instance;
+}
+
+std::size_t
+threadIndex()
+{
+    static std::atomic<std::size_t> counter;
+    thread_local const std::size_t index = counter++;
+    return index;
+}
+
+} // namespace
+
+SessionPool::Ptr
+SessionPool::create(std::size_t capacity, Factory factory)
+{
+    return Ptr(new SessionPool(capacity, std::move(factory)));
+}
+
+SessionPool::SessionPool(std::size_t capacity, Factory factory)
+    : _capacity{capacity}
+    , _factory{std::move(factory)}
+    , _shards(std::max(1U, std::thread::hardware_concurrency()))
+{
+    BOOST_ASSERT(_factory);
+    for (auto& shard : _shards) {
+        shard.sessions.reserve(_capacity);
+    }
+}
+
+std::size_t
+SessionPool::capacity() const
+{
+    return _capacity;
+}
+
+std::size_t
+SessionPool::idle() const
+{
+    std::size_t count{};
+    for (const auto& shard : _shards) {
+        std::lock_guard lock{shard.guard};
+        count += shard.sessions.size();
+    }
+    return count;
+}
+
+RecognitionSession::Ptr
+SessionPool::acquire()
+{
+    if (auto& shard = this->shard(); _capacity > 0) {
+        std::lock_guard lock{shard.guard};
+        if (not shard.sessions.empty()) {
+            auto session = std::move(shard.sessions.back());
+            shard.sessions.pop_back();
+            metrics().hits.increment();
+            metrics().idle.decrement();
+            return session;
+        }
+    }
+
+    metrics().misses.increment();
+    return _factory([weak = weak_from_this()](RecognitionSession::Ptr session) {
+        if (auto self = weak.lock(); self) {
+            self->release(std::move(session));
+        }
+    });
+}
+
+void
+SessionPool::release(RecognitionSession::Ptr session)
+{
+    BOOST_ASSERT(session);
+    auto& shard = this->shard();
+    std::lock_guard lock{shard.guard};
+    if (shard.sessions.size() < _capacity) {
+        shard.sessions.push_back(std::move(session));
+        metrics().idle.increment();
+    }
+}
+
+SessionPool::Shard&
+SessionPool::shard()
+{
+    return _shards[threadIndex() % _shards.size()];
+}
+
+} // namespace jar
\ No newline at end of file
@@ -16,44 +16,48 @@
 
 #include <boost/assert.hpp>
 
+#include <algorithm>
+
 namespace jar {
 
 SpeechDataBuffer::SpeechDataBuffer(std::size_t capacity)
-    : _buffer{capacity}
+    : _capacity{capacity}
+    , _buffer{capacity}
 {
-    BOOST_ASSERT(_buffer.is_linearized());
 }
 
 bool
 SpeechDataBuffer::empty() const
 {
     std::lock_guard lock{_guard};
-    return _buffer.empty();
+    return (_written == 0);
 }
 
 bool
 SpeechDataBuffer::completed() const
 {
+    std::lock_guard lock{_guard};
     return _completed;
 }
 
-std::size_t
-SpeechDataBuffer::size() const
+bool
+SpeechDataBuffer::overflowed() const
 {
     std::lock_guard lock{_guard};
-    return _buffer.size();
+    return _overflowed;
 }
 
 std::size_t
-SpeechDataBuffer::available() const
+SpeechDataBuffer::size() const
 {
     std::lock_guard lock{_guard};
-    return (_buffer.size() - _offset);
+    return _written;
 }
 
 std::size_t
 SpeechDataBuffer::capacity() const
 {
+    std::lock_guard lock{_guard};
     return _buffer.capacity();
 }
 
@@ -61,22 +65,49 @@ void
 SpeechDataBuffer::write(std::string_view data)
 {
     std::lock_guard lock{_guard};
+    _written += data.size();
+    if (_overflowed) {
+        return;
+    }
+    if (_buffer.size() + data.size() > _buffer.capacity()) {
+        /* Release memory since the speech can't be replayed anyway */
+        _overflowed = true;
+        boost::circular_buffer_space_optimized<char>{}.swap(_buffer);
+        return;
+    }
     _buffer.insert(_buffer.end(), data.begin(), data.end());
 }
 
-io::const_buffer
-SpeechDataBuffer::extract()
+std::size_t
+SpeechDataBuffer::read(std::size_t offset, std::string& output, std::size_t size) const
 {
     std::lock_guard lock{_guard};
-    auto buffer = io::buffer(_buffer.linearize() + _offset, _buffer.size() - _offset);
-    _offset = _buffer.size();
-    return buffer;
+    BOOST_ASSERT(not _overflowed);
+    if (offset >= _buffer.size()) {
+        return 0;
+    }
+    size = std::min(size, _buffer.size() - offset);
+    const auto begin = _buffer.begin() + static_cast<std::ptrdiff_t>(offset);
+    output.append(begin, begin + static_cast<std::ptrdiff_t>(size));
+    return size;
 }
 
 void
 SpeechDataBuffer::complete()
 {
+    std::lock_guard lock{_guard};
     _completed = true;
 }
 
+void
+SpeechDataBuffer::reset()
+{
+    std::lock_guard lock{_guard};
+    _written = 0;
+    _completed = false;
+    _overflowed = false;
+    _buffer.clear();
+    _buffer.set_capacity(_capacity);
+}
+
 } // namespace jar
\ No newline at end of file
@@ -98,6 +98,13 @@ isSpeechTarget(std::string_view input)
     return input.starts_with(kPrefix);
 }
 
+bool
+isMetricsTarget(std::string_view input)
+{
+    static constexpr std::string_view kPrefix{"/metrics"};
+    return input.starts_with(kPrefix);
+}
+
 } // namespace parser
 
 } // namespace jar
@@ -0,0 +1,85 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "intent/AdmissionController.hpp"
+
+#include <thread>
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+using Kind = AdmissionController::Kind;
+
+TEST(AdmissionControllerTest, LimitSessions)
+{
+    auto controller = AdmissionController::create({.maxSessions = 2});
+
+    auto ticket1 = controller->tryAdmit(Kind::Session);
+    auto ticket2 = controller->tryAdmit(Kind::Session);
+    EXPECT_TRUE(ticket1);
+    EXPECT_TRUE(ticket2);
+    EXPECT_FALSE(controller->tryAdmit(Kind::Session));
+    EXPECT_EQ(controller->sessions(), 2U);
+
+    /* The admission is released along with the ticket */
+    ticket1 = {};
+    EXPECT_EQ(controller->sessions(), 1U);
+    EXPECT_TRUE(controller->tryAdmit(Kind::Session));
+}
+
+TEST(AdmissionControllerTest, AdaptSpeechLimit)
+{
+    auto controller = AdmissionController::create(
+        {.minSpeechSessions = 2, .maxSpeechSessions = 4, .targetLatency = 1s});
+    EXPECT_DOUBLE_EQ(controller->speechLimit(), 4.0);
+
+    /* Multiplicative decrease upon exceeding target latency */
+    controller->update(2s, true);
+    EXPECT_DOUBLE_EQ(controller->speechLimit(), 3.6);
+    for (int n = 0; n < 20; ++n) {
+        controller->update(0s, false);
+    }
+    EXPECT_DOUBLE_EQ(controller->speechLimit(), 2.0);
+
+    auto ticket1 = controller->tryAdmit(Kind::Speech);
+    auto ticket2 = controller->tryAdmit(Kind::Speech);
+    EXPECT_TRUE(ticket1);
+    EXPECT_TRUE(ticket2);
+    EXPECT_FALSE(controller->tryAdmit(Kind::Speech));
+
+    /* Additive increase within target latency */
+    ticket1.complete(true);
+    EXPECT_DOUBLE_EQ(controller->speechLimit(), 2.5);
+    EXPECT_EQ(controller->speechSessions(), 1U);
+}
+
+TEST(AdmissionControllerTest, MeasureLatencySince)
+{
+    auto controller = AdmissionController::create(
+        {.minSpeechSessions = 2, .maxSpeechSessions = 4, .targetLatency = 50ms});
+    auto ticket1 = controller->tryAdmit(Kind::Speech);
+    auto ticket2 = controller->tryAdmit(Kind::Speech);
+    std::this_thread::sleep_for(100ms);
+
+    /* The time before given time point (e.g. the upload of speech) isn't taken as latency */
+    ticket1.complete(true, AdmissionController::Clock::now());
+    EXPECT_DOUBLE_EQ(controller->speechLimit(), 4.0);
+    ticket2.complete(true);
+    EXPECT_DOUBLE_EQ(controller->speechLimit(), 3.6);
+}
\ No newline at end of file
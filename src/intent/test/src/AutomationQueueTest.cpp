@@ -0,0 +1,98 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "intent/AutomationQueue.hpp"
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+using Priority = AutomationQueue::Priority;
+using Overflow = AutomationQueue::Overflow;
+
+TEST(AutomationQueueTest, LimitRunning)
+{
+    AutomationQueue queue{{.maxRunning = 2, .maxRunningPerAutomation = 0}};
+
+    EXPECT_TRUE(queue.push("a", Priority::Interactive));
+    EXPECT_TRUE(queue.push("b", Priority::Interactive));
+    EXPECT_TRUE(queue.push("c", Priority::Interactive));
+    EXPECT_THAT(queue.pop(), ElementsAre("a", "b"));
+    EXPECT_EQ(queue.running(), 2U);
+    EXPECT_EQ(queue.queued(), 1U);
+    EXPECT_THAT(queue.pop(), IsEmpty());
+
+    /* The released slot is taken by the next automation */
+    queue.release("a");
+    EXPECT_THAT(queue.pop(), ElementsAre("c"));
+    EXPECT_EQ(queue.queued(), 0U);
+}
+
+TEST(AutomationQueueTest, LimitRunningPerAutomation)
+{
+    AutomationQueue queue{{.maxRunning = 0, .maxRunningPerAutomation = 1}};
+
+    EXPECT_TRUE(queue.push("a", Priority::Interactive));
+    EXPECT_TRUE(queue.push("a", Priority::Interactive));
+    EXPECT_TRUE(queue.push("b", Priority::Interactive));
+    /* The automation exceeding its limit doesn't hold the others back */
+    EXPECT_THAT(queue.pop(), ElementsAre("a", "b"));
+    EXPECT_THAT(queue.pop(), IsEmpty());
+
+    queue.release("a");
+    EXPECT_THAT(queue.pop(), ElementsAre("a"));
+}
+
+TEST(AutomationQueueTest, Priorities)
+{
+    AutomationQueue queue{{.maxRunning = 1}};
+
+    EXPECT_TRUE(queue.push("scheduled", Priority::Scheduled));
+    EXPECT_TRUE(queue.push("interactive", Priority::Interactive));
+    EXPECT_THAT(queue.pop(), ElementsAre("interactive"));
+    queue.release("interactive");
+    EXPECT_THAT(queue.pop(), ElementsAre("scheduled"));
+}
+
+TEST(AutomationQueueTest, RejectOnOverflow)
+{
+    AutomationQueue queue{{.maxRunning = 1, .capacity = 2, .overflow = Overflow::Reject}};
+
+    EXPECT_TRUE(queue.push("a", Priority::Interactive));
+    EXPECT_TRUE(queue.push("b", Priority::Interactive));
+    EXPECT_FALSE(queue.push("c", Priority::Interactive));
+    EXPECT_EQ(queue.queued(), 2U);
+    EXPECT_THAT(queue.pop(), ElementsAre("a"));
+}
+
+TEST(AutomationQueueTest, DropOldestOnOverflow)
+{
+    AutomationQueue queue{{.maxRunning = 1, .capacity = 2, .overflow = Overflow::DropOldest}};
+
+    EXPECT_TRUE(queue.push("a", Priority::Scheduled));
+    EXPECT_TRUE(queue.push("b", Priority::Interactive));
+    /* The oldest automation of the lowest priority class is dropped */
+    EXPECT_TRUE(queue.push("c", Priority::Interactive));
+    EXPECT_EQ(queue.queued(), 2U);
+    /* The automation of higher priority class is never dropped for lower one */
+    EXPECT_FALSE(queue.push("d", Priority::Scheduled));
+
+    EXPECT_THAT(queue.pop(), ElementsAre("b"));
+    queue.release("b");
+    EXPECT_THAT(queue.pop(), ElementsAre("c"));
+}
\ No newline at end of file
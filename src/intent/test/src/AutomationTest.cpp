@@ -42,10 +42,11 @@ public:
         return Action::Ptr{new TestAction{*this}};
     }
 
-    void
-    execute(io::any_io_executor executor) final
+    [[nodiscard]] io::awaitable<std::error_code>
+    run(io::any_io_executor executor) final
     {
-        io::post(executor, [this]() { complete(_returnCode); });
+        co_await io::post(executor, io::use_awaitable);
+        co_return _returnCode;
     }
 
 private:
@@ -83,7 +84,7 @@ TEST_F(AutomationTest, Successful)
 
     const auto automation = Automation::create("Test Automation",
                                                "Test Intent",
-                                               jar::Action::List{action1.clone(), action2.clone()},
+                                               ActionDefs{action1.clone(), action2.clone()},
                                                strategy.clone());
     automation->onComplete(waiter.enroll([&](const std::error_code ec) { callback.Call(ec); }));
     automation->execute(worker.executor());
@@ -103,7 +104,7 @@ TEST_F(AutomationTest, Unsuccessful)
 
     const auto automation = Automation::create("Test Automation",
                                                "Test Intent",
-                                               jar::Action::List{action1.clone(), action2.clone()},
+                                               ActionDefs{action1.clone(), action2.clone()},
                                                strategy.clone());
     automation->onComplete(waiter.enroll([&](const std::error_code ec) { callback.Call(ec); }));
     automation->execute(worker.executor());
@@ -0,0 +1,53 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "intent/ChannelMemoryPool.hpp"
+
+using namespace jar;
+using namespace testing;
+
+TEST(ChannelMemoryPoolTest, Budget)
+{
+    auto pool = ChannelMemoryPool::create(4096);
+    EXPECT_EQ(pool->budget(), 4096U);
+
+    void* ptr1 = pool->allocate(2048);
+    EXPECT_EQ(pool->used(), 2048U);
+    void* ptr2 = pool->allocate(2048);
+    EXPECT_EQ(pool->used(), 4096U);
+
+    /* The allocation beyond the budget is rejected */
+    EXPECT_THROW(std::ignore = pool->allocate(1), std::bad_alloc);
+
+    pool->deallocate(ptr1, 2048);
+    EXPECT_EQ(pool->used(), 2048U);
+    ptr1 = pool->allocate(1024);
+    EXPECT_EQ(pool->used(), 3072U);
+
+    pool->deallocate(ptr1, 1024);
+    pool->deallocate(ptr2, 2048);
+    EXPECT_EQ(pool->used(), 0U);
+}
+
+TEST(ChannelMemoryPoolTest, Unlimited)
+{
+    auto pool = ChannelMemoryPool::create(0);
+    void* ptr = pool->allocate(8 * 1024 * 1024);
+    EXPECT_EQ(pool->used(), 8U * 1024 * 1024);
+    pool->deallocate(ptr, 8 * 1024 * 1024);
+    EXPECT_EQ(pool->used(), 0U);
+}
\ No newline at end of file
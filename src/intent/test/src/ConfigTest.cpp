@@ -17,6 +17,7 @@
 
 #include <string_view>
 
+#include "intent/ActionDef.hpp"
 #include "intent/Automation.hpp"
 #include "intent/Config.hpp"
 #include "intent/MockAutomationRegistry.hpp"
@@ -29,6 +30,41 @@ server =
 {
     port = 8080;
     threads = 8;
+    sessionPoolSize = 16;
+    speech =
+    {
+        captureSize = 65536;
+        retries = 2;
+        channelCapacity = 262144;
+        channelBudget = 16777216;
+    };
+    admission =
+    {
+        maxSessions = 128;
+        minSpeechSessions = 2;
+        maxSpeechSessions = 32;
+        targetLatency = 1500;
+        retryAfter = 3;
+    };
+    automation =
+    {
+        maxRunning = 8;
+        maxRunningPerAutomation = 2;
+        queueCapacity = 64;
+        overflow = "dropOldest";
+        http =
+        {
+            maxIdlePerHost = 2;
+            idleTimeout = 10000;
+        };
+    };
+};
+
+limiter =
+{
+    rate = 20;
+    burst = 5;
+    maxWait = 500;
 };
 
 wit =
@@ -76,6 +112,17 @@ automations =
                 port = 1883;
                 user = "denys";
                 pass = "123456";
+            },
+            {
+                type = "http";
+                url = "https://hooks.local:8443/light?state=off";
+                method = "PUT";
+                headers =
+                {
+                    Authorization = "Bearer 123456";
+                };
+                body = "{\"state\": \"OFF\"}";
+                timeout = 2000;
             }
         );
     }
@@ -110,8 +157,51 @@ TEST_F(ConfigTest, Load)
     EXPECT_THAT(automations[1]->alias(), "Turn off the light");
     EXPECT_THAT(automations[1]->intent(), "light_off");
 
+    /* The actions are stored by definitions */
+    ASSERT_THAT(automations[0]->actions(), SizeIs(1));
+    const auto* script = std::get_if<ScriptAction::Params>(&automations[0]->actions()[0]);
+    ASSERT_NE(script, nullptr);
+    EXPECT_EQ(script->exec, "program1");
+    EXPECT_THAT(script->args, ElementsAre("-arg1", "-arg2", "value"));
+    EXPECT_EQ(script->timeout, std::chrono::milliseconds{3000});
+    ASSERT_THAT(automations[1]->actions(), SizeIs(2));
+    const auto* mqtt = std::get_if<MqttAction::Params>(&automations[1]->actions()[0]);
+    ASSERT_NE(mqtt, nullptr);
+    EXPECT_EQ(mqtt->host, "192.168.1.43");
+    EXPECT_EQ(mqtt->port, 1883);
+    EXPECT_THAT(mqtt->user, Optional(std::string{"denys"}));
+    const auto* hook = std::get_if<HttpAction::Params>(&automations[1]->actions()[1]);
+    ASSERT_NE(hook, nullptr);
+    EXPECT_EQ(hook->endpoint.host, "hooks.local");
+    EXPECT_EQ(hook->endpoint.port, "8443");
+    EXPECT_TRUE(hook->endpoint.tls);
+    EXPECT_EQ(hook->method, http::verb::put);
+    EXPECT_EQ(hook->target, "/light?state=off");
+    EXPECT_THAT(hook->headers, ElementsAre(Pair("Authorization", "Bearer 123456")));
+    EXPECT_EQ(hook->timeout, std::chrono::milliseconds{2000});
+    EXPECT_EQ(hook->pool, config.httpPool());
+
     EXPECT_EQ(config.serverPort(), 8080);
     EXPECT_EQ(config.serverThreads(), 8);
+    EXPECT_EQ(config.sessionOptions().speechCaptureSize, 65536);
+    EXPECT_EQ(config.sessionOptions().speechRetries, 2);
+    EXPECT_EQ(config.sessionOptions().speechChannelCapacity, 262144);
+    EXPECT_EQ(config.sessionOptions().speechChannelBudget, 16777216);
+    EXPECT_EQ(config.sessionOptions().sessionPoolSize, 16);
+    EXPECT_EQ(config.admissionOptions().maxSessions, 128);
+    EXPECT_EQ(config.admissionOptions().minSpeechSessions, 2);
+    EXPECT_EQ(config.admissionOptions().maxSpeechSessions, 32);
+    EXPECT_EQ(config.admissionOptions().targetLatency, std::chrono::milliseconds{1500});
+    EXPECT_EQ(config.admissionOptions().retryAfter, std::chrono::seconds{3});
+    EXPECT_EQ(config.automationQueueOptions().maxRunning, 8);
+    EXPECT_EQ(config.automationQueueOptions().maxRunningPerAutomation, 2);
+    EXPECT_EQ(config.automationQueueOptions().capacity, 64);
+    EXPECT_EQ(config.automationQueueOptions().overflow, AutomationQueue::Overflow::DropOldest);
+    EXPECT_EQ(config.httpPoolOptions().maxIdlePerHost, 2);
+    EXPECT_EQ(config.httpPoolOptions().idleTimeout, std::chrono::milliseconds{10000});
+    EXPECT_DOUBLE_EQ(config.limiterOptions().rate, 20.0);
+    EXPECT_DOUBLE_EQ(config.limiterOptions().burst, 5.0);
+    EXPECT_EQ(config.limiterOptions().maxWait, std::chrono::milliseconds{500});
 
     EXPECT_THAT(config.witRemoteHost(), Optional(std::string{"api.wit.ai"}));
     EXPECT_THAT(config.witRemotePort(), Optional(std::string{"https"}));
@@ -0,0 +1,54 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "common/Metrics.hpp"
+#include "intent/ExecutorPool.hpp"
+
+#include <future>
+#include <thread>
+
+using namespace testing;
+using namespace jar;
+
+TEST(ExecutorPoolTest, Run)
+{
+    ExecutorPool pool{"test-run", 2};
+    EXPECT_EQ(pool.name(), "test-run");
+    EXPECT_EQ(pool.threads(), 2U);
+    pool.start();
+
+    std::promise<std::thread::id> promise;
+    io::post(pool.executor(), [&]() { promise.set_value(std::this_thread::get_id()); });
+    auto future = promise.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds{1}), std::future_status::ready);
+    /* The work is run by own threads of pool */
+    EXPECT_NE(future.get(), std::this_thread::get_id());
+
+    pool.stop();
+}
+
+TEST(ExecutorPoolTest, QueueLatency)
+{
+    ExecutorPool pool{"test-latency", 1, std::chrono::milliseconds{10}};
+    pool.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    pool.stop();
+
+    const auto snapshot = Metrics::instance().snapshot();
+    const auto it = snapshot.histograms.find("executor.test-latency.queue_latency");
+    ASSERT_NE(it, snapshot.histograms.end());
+    EXPECT_GT(it->second.count, 0U);
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "intent/FixedBufferPool.hpp"
+#include "intent/FixedBufferReader.hpp"
+
+#include <jarvisto/network/Http.hpp>
+
+#include <string>
+
+using namespace testing;
+using namespace jar;
+
+TEST(FixedBufferPoolTest, Acquire)
+{
+    io::io_context context;
+    auto pool = FixedBufferPool::create(context.get_executor(), 2, 1024);
+    EXPECT_EQ(pool->count(), 2U);
+    EXPECT_EQ(pool->size(), 1024U);
+
+    auto lease1 = pool->acquire();
+    auto lease2 = pool->acquire();
+    ASSERT_TRUE(lease1);
+    ASSERT_TRUE(lease2);
+    EXPECT_EQ(lease1.buffer().size(), 1024U);
+    EXPECT_NE(lease1.buffer().data(), lease2.buffer().data());
+    EXPECT_FALSE(pool->acquire());
+
+    /* The buffer is returned back upon the lease is destroyed */
+    lease1 = {};
+    EXPECT_TRUE(pool->acquire());
+}
+
+TEST(FixedBufferPoolTest, ReadChunks)
+{
+    static const std::string kHeader{"POST /speech HTTP/1.1\r\n"
+                                     "Transfer-Encoding: chunked\r\n"
+                                     "\r\n"};
+    const std::string chunk1(40, 'a'), chunk2(8, 'b');
+    const std::string chunks = "28\r\n" + chunk1 + "\r\n8\r\n" + chunk2 + "\r\n0\r\n\r\n";
+
+    io::io_context context;
+    tcp::acceptor acceptor{context, tcp::endpoint{io::ip::make_address("127.0.0.1"), 0}};
+    tcp::socket client{context};
+    client.connect(acceptor.local_endpoint());
+    tcp::socket server = acceptor.accept();
+    io::write(client, io::buffer(kHeader));
+
+    /* The fixed buffer is smaller than request to make the reader compact the data */
+    auto pool = FixedBufferPool::create(context.get_executor(), 1, 32);
+    RecognitionHandler::Buffer pending;
+    RecognitionHandler::Parser parser;
+    http::read_header(server, pending, parser);
+    io::write(client, io::buffer(chunks));
+    client.shutdown(tcp::socket::shutdown_send);
+
+    std::string body;
+    parser.on_chunk_body([&](std::uint64_t, std::string_view data, sys::error_code&) {
+        body.append(data);
+        return data.size();
+    });
+
+    ASSERT_TRUE(FixedBufferReader::canTakeOver(pool->acquire(), pending));
+    FixedBufferReader reader{pool->acquire(), pending};
+    EXPECT_EQ(pending.size(), 0U);
+
+    sys::error_code ec;
+    io::co_spawn(
+        context,
+        [&]() -> io::awaitable<void> { ec = co_await reader.read(server, parser); },
+        io::detached);
+    context.run();
+
+    EXPECT_FALSE(ec);
+    EXPECT_TRUE(parser.is_done());
+    EXPECT_EQ(body, chunk1 + chunk2);
+}
\ No newline at end of file
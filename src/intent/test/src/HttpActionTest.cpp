@@ -0,0 +1,266 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "common/Metrics.hpp"
+#include "intent/HttpAction.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/* The local HTTP server keeping the connections alive unless the "/close" is requested (or
+   the "/drop" is requested over the kept-alive connection) */
+class HttpServer {
+public:
+    HttpServer()
+        : _acceptor{_context, tcp::endpoint{io::ip::make_address("127.0.0.1"), 0}}
+    {
+        io::co_spawn(_context, accept(), io::detached);
+        _thread = std::thread{[this]() { _context.run(); }};
+    }
+
+    ~HttpServer()
+    {
+        _context.stop();
+        _thread.join();
+    }
+
+    [[nodiscard]] std::string
+    port() const
+    {
+        return std::to_string(_acceptor.local_endpoint().port());
+    }
+
+    [[nodiscard]] std::size_t
+    accepted() const
+    {
+        return _accepted;
+    }
+
+    [[nodiscard]] std::size_t
+    closed() const
+    {
+        return _closed;
+    }
+
+    /* Returns the host field of the last request */
+    [[nodiscard]] std::string
+    host() const
+    {
+        const std::lock_guard lock{_guard};
+        return _host;
+    }
+
+private:
+    io::awaitable<void>
+    accept()
+    {
+        for (;;) {
+            auto socket = co_await _acceptor.async_accept(io::use_awaitable);
+            ++_accepted;
+            io::co_spawn(_context, serve(std::move(socket)), io::detached);
+        }
+    }
+
+    io::awaitable<void>
+    serve(tcp::socket socket)
+    {
+        beast::flat_buffer buffer;
+        for (std::size_t n = 0;; ++n) {
+            http::request<http::string_body> request;
+            co_await http::async_read(socket, buffer, request, io::use_awaitable);
+            {
+                const std::lock_guard lock{_guard};
+                const auto host = request[http::field::host];
+                _host.assign(host.data(), host.size());
+            }
+            if (request.target() == "/drop" and n > 0) {
+                /* The connection is closed without response (e.g. upon timeout) */
+                co_return;
+            }
+            if (request.target() == "/slow") {
+                io::steady_timer timer{socket.get_executor(), 1s};
+                co_await timer.async_wait(io::use_awaitable);
+            }
+            const auto status = (request.target() == "/fail") ? http::status::internal_server_error
+                                                               : http::status::ok;
+            http::response<http::string_body> response{status, request.version()};
+            response.keep_alive(request.keep_alive());
+            response.body() = request.body();
+            response.prepare_payload();
+            co_await http::async_write(socket, response, io::use_awaitable);
+            if (request.target() == "/close") {
+                /* The connection is closed after response with keep-alive (e.g. upon timeout) */
+                socket.close();
+                ++_closed;
+                co_return;
+            }
+        }
+    }
+
+private:
+    io::io_context _context;
+    tcp::acceptor _acceptor;
+    std::atomic<std::size_t> _accepted{};
+    std::atomic<std::size_t> _closed{};
+    mutable std::mutex _guard;
+    std::string _host;
+    std::thread _thread;
+};
+
+} // namespace
+
+class HttpActionTest : public Test {
+public:
+    HttpActionTest()
+        : pool{std::make_shared<HttpConnectionPool>(HttpConnectionPool::Options{})}
+    {
+    }
+
+    std::optional<std::error_code>
+    run(const std::string& target,
+        HttpAction::Timeout timeout = HttpAction::kDefaultTimeout,
+        http::verb method = http::verb::post)
+    {
+        HttpAction::Params params;
+        params.endpoint.host = "127.0.0.1";
+        params.endpoint.port = server.port();
+        params.method = method;
+        params.target = target;
+        params.headers = {{"Content-Type", "application/json"}};
+        params.body = R"({"state": "ON"})";
+        params.timeout = timeout;
+        params.pool = pool;
+
+        std::optional<std::error_code> result;
+        io::co_spawn(context, HttpAction::run(params, context.get_executor()), [&](auto, auto ec) {
+            result = ec;
+        });
+        context.run();
+        context.restart();
+        return result;
+    }
+
+    static std::uint64_t
+    counter(const std::string& name)
+    {
+        const auto snapshot = Metrics::instance().snapshot();
+        const auto it = snapshot.counters.find(name);
+        return (it == snapshot.counters.end()) ? 0 : it->second;
+    }
+
+    HttpServer server;
+    io::io_context context;
+    std::shared_ptr<HttpConnectionPool> pool;
+};
+
+TEST_F(HttpActionTest, Send)
+{
+    const auto hits = counter("intent.http.pool_hits");
+
+    EXPECT_THAT(run("/hook"), Optional(std::error_code{}));
+    EXPECT_THAT(run("/hook"), Optional(std::error_code{}));
+    EXPECT_THAT(run("/hook"), Optional(std::error_code{}));
+
+    /* The connection is reused by subsequent requests */
+    EXPECT_EQ(server.host(), "127.0.0.1:" + server.port());
+    EXPECT_EQ(server.accepted(), 1);
+    EXPECT_EQ(counter("intent.http.pool_hits") - hits, 2);
+    EXPECT_EQ(pool->idle(), 1);
+
+    pool->clear();
+    EXPECT_EQ(pool->idle(), 0);
+}
+
+TEST_F(HttpActionTest, Reconnect)
+{
+    EXPECT_THAT(run("/close"), Optional(std::error_code{}));
+    EXPECT_EQ(pool->idle(), 1);
+    while (server.closed() == 0) {
+        std::this_thread::yield();
+    }
+
+    /* The idle connection closed by server isn't used to send request */
+    EXPECT_THAT(run("/hook"), Optional(std::error_code{}));
+    EXPECT_EQ(server.accepted(), 2);
+}
+
+TEST_F(HttpActionTest, Resend)
+{
+    EXPECT_THAT(run("/hook"), Optional(std::error_code{}));
+
+    /* The idempotent request is sent again over new connection */
+    EXPECT_THAT(run("/drop", HttpAction::kDefaultTimeout, http::verb::put),
+                Optional(std::error_code{}));
+    EXPECT_EQ(server.accepted(), 2);
+}
+
+TEST_F(HttpActionTest, NotResend)
+{
+    EXPECT_THAT(run("/hook"), Optional(std::error_code{}));
+
+    /* The server might have acted on non-idempotent request before closing connection */
+    const auto result = run("/drop", HttpAction::kDefaultTimeout, http::verb::post);
+    ASSERT_TRUE(result);
+    EXPECT_NE(*result, std::error_code{});
+    EXPECT_EQ(server.accepted(), 1);
+}
+
+TEST_F(HttpActionTest, Failure)
+{
+    EXPECT_THAT(run("/fail"), Optional(std::make_error_code(std::errc::protocol_error)));
+
+    /* The connection is kept upon error status */
+    EXPECT_THAT(run("/hook"), Optional(std::error_code{}));
+    EXPECT_EQ(server.accepted(), 1);
+}
+
+TEST_F(HttpActionTest, Timeout)
+{
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_THAT(run("/slow", 100ms), Optional(std::make_error_code(std::errc::timed_out)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+
+    /* The timed out connection isn't reused */
+    EXPECT_EQ(pool->idle(), 0);
+}
+
+TEST_F(HttpActionTest, NotExistent)
+{
+    HttpAction::Params params;
+    params.endpoint.host = "127.0.0.1";
+    params.endpoint.port = "1";
+    params.pool = pool;
+
+    std::optional<std::error_code> result;
+    io::co_spawn(context, HttpAction::run(params, context.get_executor()), [&](auto, auto ec) {
+        result = ec;
+    });
+    context.run();
+    ASSERT_TRUE(result);
+    EXPECT_NE(*result, std::error_code{});
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "common/Errors.hpp"
+#include "common/IRecognitionFactory.hpp"
+#include "intent/LimitedRecognitionFactory.hpp"
+#include "wit/BalancedRecognition.hpp"
+
+#include <vector>
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+class UnderstoodRecognition final : public Recognition {
+public:
+    io::awaitable<RecognitionResult>
+    run() final
+    {
+        co_return RecognitionResult{.isUnderstood = true, .intent = "light_on"};
+    }
+};
+
+/* The factory of recognitions balanced across endpoints (like the one of wit.ai backend) */
+class BalancedRecognitionFactory final : public IRecognitionFactory {
+public:
+    explicit BalancedRecognitionFactory(std::shared_ptr<wit::Balancer> balancer)
+        : _balancer{std::move(balancer)}
+    {
+    }
+
+    [[nodiscard]] bool
+    canRecognizeMessage() const final
+    {
+        return true;
+    }
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    message(io::any_io_executor /*executor*/, std::string /*message*/) final
+    {
+        created++;
+        return wit::BalancedRecognition::create(_balancer, [](const wit::Remote& /*remote*/) {
+            return std::make_shared<UnderstoodRecognition>();
+        });
+    }
+
+    [[nodiscard]] bool
+    canRecognizeSpeech() const final
+    {
+        return false;
+    }
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    speech(io::any_io_executor /*executor*/, std::shared_ptr<DataChannel> /*channel*/) final
+    {
+        return {};
+    }
+
+    std::size_t created{};
+
+private:
+    std::shared_ptr<wit::Balancer> _balancer;
+};
+
+} // namespace
+
+TEST(LimitedRecognitionTest, RejectBeforeBackend)
+{
+    auto balancer = std::make_shared<wit::Balancer>(
+        std::vector<wit::Remote>{{.host = "api.wit.ai", .port = "https", .auth = "0"}});
+    auto backend = std::make_shared<BalancedRecognitionFactory>(balancer);
+    auto limiter = std::make_shared<RateLimiter>(
+        RateLimiter::Options{.rate = 0.1, .burst = 1.0, .maxWait = 0ms});
+    LimitedRecognitionFactory factory{backend, limiter};
+
+    io::io_context context;
+    std::vector<sys::error_code> results;
+    for (int n = 0; n < 2; ++n) {
+        auto recognition = factory.message(context.get_executor(), "turn on the light");
+        io::co_spawn(context, recognition->run(), [&](auto eptr, auto /*result*/) {
+            try {
+                if (eptr) {
+                    std::rethrow_exception(eptr);
+                }
+                results.emplace_back(sys::error_code{});
+            } catch (const sys::system_error& e) {
+                results.emplace_back(e.code());
+            }
+        });
+        context.run();
+        context.restart();
+    }
+
+    /* The rejected recognition doesn't reach the backend (no endpoint is held) */
+    EXPECT_THAT(results,
+                ElementsAre(sys::error_code{}, sys::error_code{RecognitionErrc::RateLimited}));
+    EXPECT_EQ(backend->created, 1U);
+    EXPECT_EQ(balancer->outstanding(0), 0U);
+}
+
+TEST(LimitedRecognitionTest, CancelQueued)
+{
+    auto balancer = std::make_shared<wit::Balancer>(
+        std::vector<wit::Remote>{{.host = "api.wit.ai", .port = "https", .auth = "0"}});
+    auto backend = std::make_shared<BalancedRecognitionFactory>(balancer);
+    auto limiter = std::make_shared<RateLimiter>(
+        RateLimiter::Options{.rate = 1.0, .burst = 1.0, .maxWait = 5000ms});
+    LimitedRecognitionFactory factory{backend, limiter};
+
+    io::io_context context;
+    std::vector<sys::error_code> results;
+    auto onComplete = [&](auto eptr, auto /*result*/) {
+        try {
+            if (eptr) {
+                std::rethrow_exception(eptr);
+            }
+            results.emplace_back(sys::error_code{});
+        } catch (const sys::system_error& e) {
+            results.emplace_back(e.code());
+        }
+    };
+
+    auto recognition1 = factory.message(context.get_executor(), "turn on the light");
+    io::co_spawn(context, recognition1->run(), onComplete);
+    context.run();
+    context.restart();
+
+    /* The second recognition is queued waiting for the token */
+    auto recognition2 = factory.message(context.get_executor(), "turn on the light");
+    io::co_spawn(context, recognition2->run(), onComplete);
+    context.poll();
+    EXPECT_EQ(limiter->pending(), 1U);
+
+    /* The cancelled recognition doesn't reach the backend and returns the token */
+    recognition2->cancel();
+    context.run();
+    EXPECT_THAT(results,
+                ElementsAre(sys::error_code{}, sys::error_code{io::error::operation_aborted}));
+    EXPECT_EQ(backend->created, 1U);
+    EXPECT_EQ(limiter->pending(), 0U);
+    const auto wait = limiter->reserve();
+    ASSERT_TRUE(wait);
+    EXPECT_LE(*wait, 1s);
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "common/Metrics.hpp"
+#include "intent/PluginAction.hpp"
+
+#include <chrono>
+#include <optional>
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+class PluginActionTest : public Test {
+public:
+    Plugin::Ptr
+    load(const std::string& name, const std::string& config)
+    {
+        std::error_code ec;
+        auto plugin = Plugin::load(name, TEST_PLUGIN_PATH, config, ec);
+        EXPECT_EQ(ec, std::error_code{});
+        return plugin;
+    }
+
+    std::optional<std::error_code>
+    run(Plugin::Ptr plugin, PluginAction::Timeout timeout = PluginAction::kDefaultTimeout)
+    {
+        const PluginAction::Params params{.plugin = std::move(plugin), .timeout = timeout};
+        std::optional<std::error_code> result;
+        auto strand = io::make_strand(context);
+        io::co_spawn(strand, PluginAction::run(params, strand), [&](auto, std::error_code ec) {
+            result = ec;
+        });
+        context.run();
+        context.restart();
+        return result;
+    }
+
+    static std::uint64_t
+    counter(const std::string& name)
+    {
+        const auto snapshot = Metrics::instance().snapshot();
+        const auto it = snapshot.counters.find(name);
+        return (it == snapshot.counters.end()) ? 0 : it->second;
+    }
+
+    io::io_context context;
+};
+
+TEST_F(PluginActionTest, Execute)
+{
+    auto plugin = load("test-done", "done");
+    ASSERT_TRUE(plugin);
+    EXPECT_EQ(plugin->name(), "test-done");
+
+    EXPECT_THAT(run(plugin), Optional(std::error_code{}));
+    EXPECT_THAT(run(plugin), Optional(std::error_code{}));
+
+    const auto snapshot = Metrics::instance().snapshot();
+    ASSERT_TRUE(snapshot.histograms.contains("intent.plugin.test-done.latency_ms"));
+    EXPECT_EQ(snapshot.histograms.at("intent.plugin.test-done.latency_ms").count, 2);
+}
+
+TEST_F(PluginActionTest, ExecuteOnThread)
+{
+    auto plugin = load("test-thread", "thread");
+    ASSERT_TRUE(plugin);
+
+    /* The completion given on the thread of plugin is handed off to the strand */
+    EXPECT_THAT(run(plugin), Optional(std::error_code{}));
+}
+
+TEST_F(PluginActionTest, Failure)
+{
+    auto plugin = load("test-fail", "fail");
+    ASSERT_TRUE(plugin);
+
+    EXPECT_THAT(run(plugin), Optional(std::make_error_code(std::errc::io_error)));
+    EXPECT_EQ(counter("intent.plugin.test-fail.failures"), 1);
+
+    auto rejecting = load("test-reject", "reject");
+    ASSERT_TRUE(rejecting);
+    EXPECT_THAT(run(rejecting), Optional(std::make_error_code(std::errc::device_or_resource_busy)));
+}
+
+TEST_F(PluginActionTest, Timeout)
+{
+    auto plugin = load("test-hang", "hang");
+    ASSERT_TRUE(plugin);
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_THAT(run(plugin, 100ms), Optional(std::make_error_code(std::errc::timed_out)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+    EXPECT_EQ(counter("intent.plugin.test-hang.timeouts"), 1);
+
+    /* The cancelled execution is completed and releases the plugin */
+    context.run();
+    EXPECT_EQ(plugin.use_count(), 1);
+}
+
+TEST_F(PluginActionTest, NotExistent)
+{
+    std::error_code ec;
+    EXPECT_FALSE(Plugin::load("test-none", "/not/existent/plugin.so", {}, ec));
+    EXPECT_NE(ec, std::error_code{});
+
+    /* The plugin rejecting the config is not loaded */
+    EXPECT_FALSE(Plugin::load("test-init", TEST_PLUGIN_PATH, {}, ec));
+    EXPECT_NE(ec, std::error_code{});
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "intent/RateLimiter.hpp"
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+TEST(RateLimiterTest, Burst)
+{
+    RateLimiter limiter{{.rate = 10.0, .burst = 2.0, .maxWait = 1s}};
+    const auto now = RateLimiter::Clock::now() + 1s;
+
+    EXPECT_THAT(limiter.reserve(now), Optional(Eq(RateLimiter::Clock::duration::zero())));
+    EXPECT_THAT(limiter.reserve(now), Optional(Eq(RateLimiter::Clock::duration::zero())));
+
+    /* The next request waits for the token to be refilled (100ms per token) */
+    const auto wait = limiter.reserve(now);
+    ASSERT_TRUE(wait);
+    EXPECT_THAT(std::chrono::round<std::chrono::milliseconds>(*wait), Eq(100ms));
+}
+
+TEST(RateLimiterTest, RejectExceedingMaxWait)
+{
+    RateLimiter limiter{{.rate = 10.0, .burst = 1.0, .maxWait = 150ms}};
+    const auto now = RateLimiter::Clock::now() + 1s;
+
+    EXPECT_TRUE(limiter.reserve(now));
+    EXPECT_TRUE(limiter.reserve(now));
+    EXPECT_FALSE(limiter.reserve(now));
+
+    limiter.refund();
+    EXPECT_TRUE(limiter.reserve(now));
+}
+
+TEST(RateLimiterTest, Acquire)
+{
+    RateLimiter limiter{{.rate = 100.0, .burst = 1.0, .maxWait = 1s}};
+
+    io::io_context context;
+    std::size_t acquired{};
+    for (int n = 0; n < 3; ++n) {
+        io::co_spawn(
+            context,
+            [&]() -> io::awaitable<void> {
+                if (co_await limiter.acquire()) {
+                    acquired++;
+                }
+            },
+            io::detached);
+    }
+    context.run();
+    EXPECT_EQ(acquired, 3U);
+    EXPECT_EQ(limiter.pending(), 0U);
+}
\ No newline at end of file
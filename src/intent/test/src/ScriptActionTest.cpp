@@ -17,14 +17,18 @@
 
 #include "intent/ScriptAction.hpp"
 
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <optional>
 
 using namespace jar;
 using namespace testing;
 
 namespace fs = std::filesystem;
 
+using namespace std::chrono_literals;
+
 static void
 createFile(const fs::path& path)
 {
@@ -73,4 +77,83 @@ TEST_F(ScriptActionTest, NotExistent)
     action->execute(ctx.get_executor());
 
     ctx.run();
+}
+
+TEST_F(ScriptActionTest, Timeout)
+{
+    auto action = ScriptAction::create("sleep", {"10"}, {}, {}, false, ScriptAction::Timeout{100});
+    ASSERT_TRUE(action);
+
+    std::optional<std::error_code> result;
+    io::co_spawn(context, action->run(context.get_executor()), [&](auto, std::error_code ec) {
+        result = ec;
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    context.run();
+    ASSERT_TRUE(result);
+    EXPECT_EQ(*result, std::errc::timed_out);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+}
+
+TEST_F(ScriptActionTest, Cancel)
+{
+    auto action = ScriptAction::create("sleep", {"10"});
+    ASSERT_TRUE(action);
+
+    /* The cancellation of awaiting coroutine terminates the program */
+    io::cancellation_signal signal;
+    std::optional<std::error_code> result;
+    io::co_spawn(context,
+                 action->run(context.get_executor()),
+                 io::bind_cancellation_slot(signal.slot(), [&](auto, std::error_code ec) {
+                     result = ec;
+                 }));
+    io::steady_timer timer{context, 100ms};
+    timer.async_wait([&](sys::error_code) { signal.emit(io::cancellation_type::terminal); });
+
+    const auto start = std::chrono::steady_clock::now();
+    context.run();
+    ASSERT_TRUE(result);
+    EXPECT_EQ(*result, std::errc::operation_canceled);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+}
+
+TEST_F(ScriptActionTest, Compile)
+{
+    ScriptAction::Params params;
+    params.exec = "sh";
+    params.env = {{"NAME", "value"}};
+    params.inheritParentEnv = true;
+    ASSERT_EQ(ScriptAction::compile(params), std::error_code{});
+    ASSERT_TRUE(params.plan);
+
+    /* The definition is resolved once and reused by all runs */
+    EXPECT_TRUE(params.plan->exec.is_absolute());
+    EXPECT_EQ(params.plan->home, fs::current_path());
+    ASSERT_TRUE(params.plan->env);
+    EXPECT_THAT(*params.plan->env, Contains("NAME=value"));
+    EXPECT_THAT(*params.plan->env, Contains(StartsWith("PATH=")));
+    EXPECT_FALSE(params.plan->request.empty());
+
+    std::optional<std::error_code> result;
+    io::co_spawn(context, ScriptAction::run(params, context.get_executor()), [&](auto, auto ec) {
+        result = ec;
+    });
+    context.run();
+    ASSERT_TRUE(result);
+    EXPECT_EQ(*result, std::error_code{});
+}
+
+TEST_F(ScriptActionTest, CompileNotExistent)
+{
+    ScriptAction::Params params;
+    params.exec = "not-existent-program";
+    EXPECT_NE(ScriptAction::compile(params), std::error_code{});
+    EXPECT_FALSE(params.plan);
+
+    params.exec = "sh";
+    params.home = "/not/existent/directory";
+    EXPECT_NE(ScriptAction::compile(params), std::error_code{});
+    EXPECT_FALSE(params.plan);
 }
\ No newline at end of file
@@ -0,0 +1,189 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "intent/ScriptAction.hpp"
+#include "intent/ScriptLauncher.hpp"
+
+#include <boost/asio/experimental/awaitable_operators.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+
+#include <signal.h>
+#include <sys/wait.h>
+
+using namespace jar;
+using namespace testing;
+
+namespace fs = std::filesystem;
+
+using namespace std::chrono_literals;
+using namespace boost::asio::experimental::awaitable_operators;
+
+class ScriptLauncherTest : public Test {
+public:
+    using Result = std::tuple<std::error_code, int>;
+
+    ScriptLauncherTest()
+        : launcher{ScriptLauncher::create()}
+    {
+    }
+
+    std::optional<Result>
+    launch(const ScriptLauncher::Command& command)
+    {
+        std::optional<Result> result;
+        io::co_spawn(context,
+                     launcher->launch(command, context.get_executor()),
+                     [&](auto, Result value) { result = value; });
+        context.run();
+        context.restart();
+        return result;
+    }
+
+    ScriptLauncher::Ptr launcher;
+    io::io_context context;
+};
+
+TEST_F(ScriptLauncherTest, Launch)
+{
+    ASSERT_TRUE(launcher);
+
+    const auto result = launch({.exec = "sh", .args = {"-c", "exit 3"}, .home = {}, .env = {}});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<0>(*result), std::error_code{});
+    EXPECT_EQ(std::get<1>(*result), 3);
+}
+
+TEST_F(ScriptLauncherTest, NotExistent)
+{
+    ASSERT_TRUE(launcher);
+
+    const auto result = launch({.exec = "not-existent-program", .args = {}, .home = {}, .env = {}});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<0>(*result), std::errc::no_such_file_or_directory);
+}
+
+TEST_F(ScriptLauncherTest, HomeAndEnvironment)
+{
+    ASSERT_TRUE(launcher);
+
+    static const char* kScript{R"sh(test "$(pwd)" = "$1" && test "$NAME" = "value")sh"};
+
+    const fs::path home = fs::canonical(fs::temp_directory_path());
+    const auto result = launch({
+        .exec = "sh",
+        .args = {"-c", kScript, "sh", home.string()},
+        .home = home,
+        .env = ScriptLauncher::Environment{"NAME=value"},
+    });
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<0>(*result), std::error_code{});
+    EXPECT_EQ(std::get<1>(*result), 0);
+}
+
+TEST_F(ScriptLauncherTest, Terminate)
+{
+    ASSERT_TRUE(launcher);
+
+    /* The program is killed once the launch is cancelled by the timer */
+    std::optional<std::size_t> winner;
+    io::co_spawn(
+        context,
+        [&]() -> io::awaitable<void> {
+            io::steady_timer timer{context, 100ms};
+            const ScriptLauncher::Command command{
+                .exec = "sleep", .args = {"10"}, .home = {}, .env = {}};
+            const auto result = co_await (launcher->launch(command, context.get_executor())
+                                          || timer.async_wait(io::use_awaitable));
+            winner = result.index();
+        },
+        io::detached);
+
+    const auto start = std::chrono::steady_clock::now();
+    context.run();
+    context.restart();
+    ASSERT_TRUE(winner);
+    EXPECT_EQ(*winner, 1);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+
+    /* The launcher keeps serving after termination */
+    const auto result = launch({.exec = "true", .args = {}, .home = {}, .env = {}});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<1>(*result), 0);
+}
+
+TEST_F(ScriptLauncherTest, RunScriptAction)
+{
+    ASSERT_TRUE(launcher);
+
+    const fs::path path{fs::temp_directory_path() / "launcher-test.txt"};
+    std::ofstream{path}.close();
+    ASSERT_TRUE(fs::exists(path));
+
+    ScriptLauncher::install(launcher);
+    std::optional<std::error_code> result;
+    ScriptAction::Params params;
+    params.exec = "rm";
+    params.args = {"-f", path.string()};
+    io::co_spawn(context, ScriptAction::run(params, context.get_executor()), [&](auto, auto ec) {
+        result = ec;
+    });
+    context.run();
+    ScriptLauncher::install({});
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(*result, std::error_code{});
+    EXPECT_FALSE(fs::exists(path));
+}
+
+TEST_F(ScriptLauncherTest, FallbackUponBrokenLauncher)
+{
+    ASSERT_TRUE(launcher);
+
+    const fs::path path{fs::temp_directory_path() / "launcher-broken-test.txt"};
+    std::ofstream{path}.close();
+    ASSERT_TRUE(fs::exists(path));
+
+    ::kill(launcher->pid(), SIGKILL);
+    ::waitpid(launcher->pid(), nullptr, 0);
+    EXPECT_TRUE(launcher->alive());
+
+    /* The program is executed directly once the launcher is found broken */
+    ScriptLauncher::install(launcher);
+    std::optional<std::error_code> result;
+    ScriptAction::Params params;
+    params.exec = "rm";
+    params.args = {"-f", path.string()};
+    io::co_spawn(context, ScriptAction::run(params, context.get_executor()), [&](auto, auto ec) {
+        result = ec;
+    });
+    context.run();
+    context.restart();
+    ScriptLauncher::install({});
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(*result, std::error_code{});
+    EXPECT_FALSE(fs::exists(path));
+    EXPECT_FALSE(launcher->alive());
+
+    const auto launched = launch({.exec = "true", .args = {}, .home = {}, .env = {}});
+    ASSERT_TRUE(launched);
+    EXPECT_EQ(std::get<0>(*launched), std::errc::broken_pipe);
+}
\ No newline at end of file
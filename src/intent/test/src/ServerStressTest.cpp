@@ -0,0 +1,255 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "common/IRecognitionFactory.hpp"
+#include "intent/Automation.hpp"
+#include "intent/AutomationPerformer.hpp"
+#include "intent/AutomationRegistry.hpp"
+#include "intent/ExecutorPool.hpp"
+#include "intent/RecognitionServer.hpp"
+#include "intent/SequentLaunchStrategy.hpp"
+
+#include <jarvisto/network/Http.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+using namespace jar;
+
+using namespace std::literals;
+
+namespace {
+
+const std::string kIntent{"stress"};
+
+class CountingAction final : public Action {
+public:
+    explicit CountingAction(std::shared_ptr<std::atomic<std::size_t>> counter)
+        : _counter{std::move(counter)}
+    {
+    }
+
+    [[nodiscard]] Ptr
+    clone() const final
+    {
+        return Action::Ptr{new CountingAction{_counter}};
+    }
+
+    [[nodiscard]] io::awaitable<std::error_code>
+    run(io::any_io_executor executor) final
+    {
+        co_await io::post(executor, io::use_awaitable);
+        _counter->fetch_add(1);
+        co_return std::error_code{};
+    }
+
+private:
+    std::shared_ptr<std::atomic<std::size_t>> _counter;
+};
+
+/* Recognizes any message or speech (the speech is received from channel until its end) */
+class StressRecognition final : public Recognition {
+public:
+    using DataChannel = IRecognitionFactory::DataChannel;
+
+    StressRecognition(io::any_io_executor executor, std::shared_ptr<DataChannel> channel = {})
+        : _executor{std::move(executor)}
+        , _channel{std::move(channel)}
+    {
+    }
+
+    io::awaitable<RecognitionResult>
+    run() final
+    {
+        if (_channel) {
+            std::array<char, 512> buffer{};
+            for (;;) {
+                const auto [ec, size] = co_await _channel->recvSome(io::buffer(buffer));
+                if (ec) {
+                    break;
+                }
+            }
+        }
+        /* Let the result be handed back from another thread */
+        co_await io::post(_executor, io::use_awaitable);
+        co_return RecognitionResult{.isUnderstood = true, .intent = kIntent};
+    }
+
+private:
+    io::any_io_executor _executor;
+    std::shared_ptr<DataChannel> _channel;
+};
+
+class StressRecognitionFactory final : public IRecognitionFactory {
+public:
+    [[nodiscard]] bool
+    canRecognizeMessage() const final
+    {
+        return true;
+    }
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    message(io::any_io_executor executor, std::string /*message*/) final
+    {
+        return std::make_shared<StressRecognition>(std::move(executor));
+    }
+
+    [[nodiscard]] bool
+    canRecognizeSpeech() const final
+    {
+        return true;
+    }
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    speech(io::any_io_executor executor, std::shared_ptr<DataChannel> channel) final
+    {
+        return std::make_shared<StressRecognition>(std::move(executor), std::move(channel));
+    }
+};
+
+tcp::socket
+connect(io::io_context& context, const tcp::endpoint& endpoint)
+{
+    tcp::socket socket{context};
+    socket.connect(endpoint);
+    return socket;
+}
+
+http::status
+sendMessage(io::io_context& context, const tcp::endpoint& endpoint)
+{
+    auto socket = connect(context, endpoint);
+    http::request<http::empty_body> request{
+        http::verb::get, "/message?q=turn+off+the+light", kHttpVersion11};
+    http::write(socket, request);
+    beast::flat_buffer buffer;
+    http::response<http::string_body> response;
+    http::read(socket, buffer, response);
+    return response.result();
+}
+
+http::status
+sendSpeech(io::io_context& context, const tcp::endpoint& endpoint)
+{
+    static constexpr std::size_t kChunks{8};
+    static const std::string kChunk(1024, '\0');
+
+    auto socket = connect(context, endpoint);
+    http::request<http::empty_body> request{http::verb::post, "/speech", kHttpVersion11};
+    request.set(http::field::transfer_encoding, "chunked");
+    request.set(http::field::expect, "100-continue");
+    http::request_serializer<http::empty_body> serializer{request};
+    http::write_header(socket, serializer);
+
+    beast::flat_buffer buffer;
+    {
+        http::response<http::empty_body> response;
+        http::read(socket, buffer, response);
+        if (response.result() != http::status::continue_) {
+            return response.result();
+        }
+    }
+    for (std::size_t n = 0; n < kChunks; ++n) {
+        io::write(socket, http::make_chunk(io::buffer(kChunk)));
+    }
+    io::write(socket, http::make_chunk_last());
+
+    http::response<http::string_body> response;
+    http::read(socket, buffer, response);
+    return response.result();
+}
+
+} // namespace
+
+/**
+ * Drives the server running on multi-threaded pools by many clients at once. The test is
+ * expected to be run by the build with thread sanitizer (see ENABLE_TSAN option).
+ */
+TEST(ServerStressTest, ConcurrentClients)
+{
+    static constexpr std::size_t kClients{8};
+    static constexpr std::size_t kRequests{32};
+
+    auto counter = std::make_shared<std::atomic<std::size_t>>(0);
+    auto registry = std::make_shared<AutomationRegistry>();
+    registry->add(Automation::create("Stress",
+                                     kIntent,
+                                     ActionDefs{std::make_shared<CountingAction>(counter)},
+                                     std::make_shared<SequentLaunchStrategy>()));
+
+    ExecutorPool ingress{"stress-ingress", 4};
+    ExecutorPool backend{"stress-backend", 4};
+    ExecutorPool automation{"stress-automation", 2};
+    automation.start();
+    backend.start();
+    ingress.start();
+
+    auto performer = AutomationPerformer::create(automation.executor(), registry);
+    auto server = RecognitionServer::create(ingress.executor(),
+                                            std::make_shared<StressRecognitionFactory>(),
+                                            performer,
+                                            SessionOptions{},
+                                            AdmissionController::Options{},
+                                            backend.executor());
+    /* The port is chosen by system to not clash with other tests */
+    const auto endpoint = server->listen(tcp::endpoint{io::ip::make_address("127.0.0.1"), 0});
+
+    std::atomic<std::size_t> recognized{0};
+    std::atomic<std::size_t> failures{0};
+    std::vector<std::thread> clients;
+    for (std::size_t n = 0; n < kClients; ++n) {
+        clients.emplace_back([&, n]() {
+            io::io_context context;
+            for (std::size_t r = 0; r < kRequests; ++r) {
+                try {
+                    const auto status = ((n + r) % 2 == 0) ? sendMessage(context, endpoint)
+                                                           : sendSpeech(context, endpoint);
+                    if (status == http::status::ok) {
+                        recognized++;
+                    } else if (status != http::status::service_unavailable) {
+                        failures++;
+                    }
+                } catch (const std::exception&) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0U);
+    EXPECT_GT(recognized.load(), 0U);
+    /* Each recognized request is acted on by automation */
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (counter->load() < recognized and std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_EQ(counter->load(), recognized.load());
+    while (performer->running() > 0 and std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_EQ(performer->running(), 0U);
+
+    ingress.stop();
+    backend.stop();
+    automation.stop();
+}
\ No newline at end of file
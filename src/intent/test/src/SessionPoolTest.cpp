@@ -0,0 +1,118 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "common/IRecognitionFactory.hpp"
+#include "intent/AutomationPerformer.hpp"
+#include "intent/AutomationRegistry.hpp"
+#include "intent/SessionPool.hpp"
+
+using namespace jar;
+using namespace testing;
+
+namespace {
+
+class NullRecognitionFactory final : public IRecognitionFactory {
+public:
+    [[nodiscard]] bool
+    canRecognizeMessage() const final
+    {
+        return false;
+    }
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    message(io::any_io_executor /*executor*/, std::string /*message*/) final
+    {
+        return {};
+    }
+
+    [[nodiscard]] bool
+    canRecognizeSpeech() const final
+    {
+        return false;
+    }
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    speech(io::any_io_executor /*executor*/, std::shared_ptr<DataChannel> /*channel*/) final
+    {
+        return {};
+    }
+};
+
+} // namespace
+
+class SessionPoolTest : public Test {
+public:
+    SessionPool::Factory
+    factory()
+    {
+        return [this](RecognitionSession::Recycler recycler) {
+            created++;
+            return RecognitionSession::create(context.get_executor(),
+                                              context.get_executor(),
+                                              recognitionFactory,
+                                              performer,
+                                              admission,
+                                              memory,
+                                              nullptr,
+                                              SessionOptions{},
+                                              std::move(recycler));
+        };
+    }
+
+public:
+    io::io_context context;
+    std::shared_ptr<IRecognitionFactory> recognitionFactory
+        = std::make_shared<NullRecognitionFactory>();
+    AutomationPerformer::Ptr performer
+        = AutomationPerformer::create(context.get_executor(), std::make_shared<AutomationRegistry>());
+    AdmissionController::Ptr admission = AdmissionController::create({});
+    ChannelMemoryPool::Ptr memory = ChannelMemoryPool::create(0);
+    std::size_t created{};
+};
+
+TEST_F(SessionPoolTest, Reuse)
+{
+    auto pool = SessionPool::create(2, factory());
+    EXPECT_EQ(pool->capacity(), 2U);
+
+    auto session1 = pool->acquire();
+    auto session2 = pool->acquire();
+    auto session3 = pool->acquire();
+    EXPECT_EQ(created, 3U);
+
+    const auto* ptr = session1.get();
+    pool->release(std::move(session1));
+    pool->release(std::move(session2));
+    /* The number of idle sessions is bounded by capacity */
+    pool->release(std::move(session3));
+    EXPECT_EQ(pool->idle(), 2U);
+
+    std::ignore = pool->acquire();
+    auto session = pool->acquire();
+    EXPECT_EQ(session.get(), ptr);
+    EXPECT_EQ(created, 3U);
+    EXPECT_EQ(pool->idle(), 0U);
+}
+
+TEST_F(SessionPoolTest, Disabled)
+{
+    auto pool = SessionPool::create(0, factory());
+    pool->release(pool->acquire());
+    EXPECT_EQ(pool->idle(), 0U);
+    pool->release(pool->acquire());
+    EXPECT_EQ(created, 2U);
+}
\ No newline at end of file
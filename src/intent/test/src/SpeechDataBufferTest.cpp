@@ -0,0 +1,70 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "intent/SpeechDataBuffer.hpp"
+
+using namespace jar;
+using namespace testing;
+
+TEST(SpeechDataBufferTest, WriteAndRead)
+{
+    SpeechDataBuffer buffer{16};
+    EXPECT_TRUE(buffer.empty());
+
+    buffer.write("0123");
+    buffer.write("4567");
+    EXPECT_EQ(buffer.size(), 8U);
+    EXPECT_FALSE(buffer.completed());
+
+    std::string output;
+    EXPECT_EQ(buffer.read(0, output, 5), 5U);
+    EXPECT_EQ(buffer.read(5, output, 5), 3U);
+    EXPECT_EQ(buffer.read(8, output, 5), 0U);
+    EXPECT_EQ(output, "01234567");
+
+    buffer.complete();
+    EXPECT_TRUE(buffer.completed());
+}
+
+TEST(SpeechDataBufferTest, Overflow)
+{
+    SpeechDataBuffer buffer{4};
+    buffer.write("012");
+    EXPECT_FALSE(buffer.overflowed());
+    buffer.write("34");
+    EXPECT_TRUE(buffer.overflowed());
+    EXPECT_EQ(buffer.size(), 5U);
+}
+
+TEST(SpeechDataBufferTest, Reset)
+{
+    SpeechDataBuffer buffer{4};
+    buffer.write("01234");
+    buffer.complete();
+    EXPECT_TRUE(buffer.overflowed());
+
+    buffer.reset();
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(buffer.completed());
+    EXPECT_FALSE(buffer.overflowed());
+    EXPECT_EQ(buffer.capacity(), 4U);
+
+    buffer.write("0123");
+    std::string output;
+    EXPECT_EQ(buffer.read(0, output, 4), 4U);
+    EXPECT_EQ(output, "0123");
+}
\ No newline at end of file
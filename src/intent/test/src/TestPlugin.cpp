@@ -0,0 +1,93 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "intent/PluginAbi.h"
+
+#include <cerrno>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace {
+
+/* The behaviour of plugin is given by config */
+struct State {
+    std::string mode;
+    std::mutex guard;
+    void* pending{};
+    rintento_plugin_done_fn done{};
+};
+
+} // namespace
+
+extern "C" {
+
+void*
+rintento_plugin_init(int abi, const char* config)
+{
+    if (abi != RINTENTO_PLUGIN_ABI_VERSION or config == nullptr or *config == '\0') {
+        return nullptr;
+    }
+    auto* self = new State;
+    self->mode = config;
+    return self;
+}
+
+int
+rintento_plugin_execute(void* state, void* call, rintento_plugin_done_fn done)
+{
+    auto* self = static_cast<State*>(state);
+    if (self->mode == "done") {
+        done(call, 0);
+        return 0;
+    }
+    if (self->mode == "fail") {
+        done(call, EIO);
+        return 0;
+    }
+    if (self->mode == "thread") {
+        std::thread{[call, done]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            done(call, 0);
+        }}.detach();
+        return 0;
+    }
+    if (self->mode == "hang") {
+        const std::lock_guard lock{self->guard};
+        self->pending = call;
+        self->done = done;
+        return 0;
+    }
+    return EBUSY;
+}
+
+void
+rintento_plugin_cancel(void* state, void* call)
+{
+    auto* self = static_cast<State*>(state);
+    const std::lock_guard lock{self->guard};
+    if (self->pending == call) {
+        self->done(std::exchange(self->pending, nullptr), ECANCELED);
+    }
+}
+
+void
+rintento_plugin_free(void* state)
+{
+    delete static_cast<State*>(state);
+}
+
+} // extern "C"
\ No newline at end of file
@@ -25,3 +25,11 @@ TEST(UtilsTest, ParseQueryParams)
     static const std::string_view in{"/message?q=turn+on+the+light"};
     EXPECT_THAT(parser::peekMessage(in), Optional(Eq("turn on the light")));
 }
+
+TEST(UtilsTest, Targets)
+{
+    EXPECT_TRUE(parser::isMessageTarget("/message?q=turn+on+the+light"));
+    EXPECT_TRUE(parser::isSpeechTarget("/speech"));
+    EXPECT_TRUE(parser::isMetricsTarget("/metrics"));
+    EXPECT_FALSE(parser::isMetricsTarget("/speech"));
+}
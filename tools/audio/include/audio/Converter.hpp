@@ -0,0 +1,60 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "audio/PolyphaseResampler.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace jar::audio {
+
+/**
+ * Converts interleaved floating point samples into the target PCM format (16kHz, mono, S16LE)
+ * by downmixing channels and resampling if necessary.
+ */
+class Converter {
+public:
+    Converter(std::uint32_t sampleRate, std::uint16_t channels);
+
+    /* Converts given whole frames and appends resulting PCM data to the output */
+    void
+    convert(std::span<const float> samples, std::string& output);
+
+    void
+    flush(std::string& output);
+
+    [[nodiscard]] std::uint32_t
+    sampleRate() const;
+
+    [[nodiscard]] std::uint16_t
+    channels() const;
+
+private:
+    static void
+    quantize(std::span<const float> samples, std::string& output);
+
+private:
+    std::uint32_t _sampleRate{};
+    std::uint16_t _channels{};
+    std::optional<PolyphaseResampler> _resampler;
+    std::vector<float> _mixed;
+    std::vector<float> _resampled;
+};
+
+} // namespace jar::audio
\ No newline at end of file
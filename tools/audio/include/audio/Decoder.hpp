@@ -0,0 +1,51 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "audio/Format.hpp"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace jar::audio {
+
+/**
+ * Incremental decoder of client audio data into the target PCM format (16kHz, mono, S16LE).
+ * Only undecoded remainder of input (not more than one frame of encoded data) is kept.
+ */
+class Decoder {
+public:
+    using Ptr = std::unique_ptr<Decoder>;
+
+    virtual ~Decoder() = default;
+
+    /* Return empty pointer if given format is not supported */
+    [[nodiscard]] static Ptr
+    create(const Format& format);
+
+    /* Decodes given portion of input data and appends resulting PCM data to the output */
+    [[nodiscard]] virtual std::error_code
+    decode(std::string_view input, std::string& output)
+        = 0;
+
+    /* Decodes remaining input data upon the end of input */
+    [[nodiscard]] virtual std::error_code
+    finalize(std::string& output)
+        = 0;
+};
+
+} // namespace jar::audio
\ No newline at end of file
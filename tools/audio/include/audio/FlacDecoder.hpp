@@ -0,0 +1,88 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "audio/Converter.hpp"
+#include "audio/Decoder.hpp"
+
+#include <FLAC/stream_decoder.h>
+
+#include <optional>
+#include <vector>
+
+namespace jar::audio {
+
+/**
+ * Streaming FLAC decoder.
+ *
+ * The libFLAC decoder pulls input data and can't be suspended in the middle of a frame.
+ * So the input is split into frames by searching for the next valid frame header and
+ * the decoder is given exactly one complete frame at a time. The data kept while searching
+ * for the next frame is limited by the largest frame of stream (the decoding fails past it).
+ */
+class FlacDecoder final : public Decoder {
+public:
+    FlacDecoder();
+
+    ~FlacDecoder() final;
+
+    [[nodiscard]] std::error_code
+    decode(std::string_view input, std::string& output) final;
+
+    [[nodiscard]] std::error_code
+    finalize(std::string& output) final;
+
+private:
+    [[nodiscard]] std::optional<std::size_t>
+    metadataSize(std::error_code& ec) const;
+
+    [[nodiscard]] std::optional<std::size_t>
+    findFrame(std::size_t from, std::size_t& scanned) const;
+
+    [[nodiscard]] std::error_code
+    decodeMetadata(std::size_t size);
+
+    [[nodiscard]] std::error_code
+    decodeFrame(std::size_t size);
+
+    static FLAC__StreamDecoderReadStatus
+    onRead(const FLAC__StreamDecoder* decoder, FLAC__byte buffer[], size_t* bytes, void* data);
+
+    static FLAC__StreamDecoderWriteStatus
+    onWrite(const FLAC__StreamDecoder* decoder,
+            const FLAC__Frame* frame,
+            const FLAC__int32* const buffer[],
+            void* data);
+
+    static void
+    onMetadata(const FLAC__StreamDecoder* decoder, const FLAC__StreamMetadata* metadata, void* data);
+
+    static void
+    onError(const FLAC__StreamDecoder* decoder, FLAC__StreamDecoderErrorStatus status, void* data);
+
+private:
+    FLAC__StreamDecoder* _decoder{};
+    std::string _pending;
+    std::string_view _feed;
+    std::string* _output{};
+    std::size_t _scanned{};
+    std::size_t _maxFrameSize{};
+    bool _hasMetadata{};
+    std::optional<Converter> _converter;
+    std::vector<float> _samples;
+    std::error_code _error;
+};
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,50 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace jar::audio {
+
+/* Sample rate of PCM data expected by recognition backend */
+static constexpr std::uint32_t kTargetSampleRate{16000};
+/* Number of channels of PCM data expected by recognition backend */
+static constexpr std::uint16_t kTargetChannels{1};
+
+enum class Codec { Raw, Wav, Flac, Opus };
+
+struct Format {
+    Codec codec{Codec::Raw};
+    std::uint32_t sampleRate{kTargetSampleRate};
+    std::uint16_t channels{kTargetChannels};
+};
+
+/**
+ * Parses audio format from the value of client "Content-Type" header field.
+ * Missing content type means raw PCM data in native format (16kHz, mono, S16LE).
+ * Return empty optional if given content type is not supported.
+ */
+[[nodiscard]] std::optional<Format>
+parseContentType(std::string_view contentType);
+
+[[nodiscard]] bool
+isNative(const Format& format);
+
+[[nodiscard]] bool
+isSampleRateSupported(std::uint32_t sampleRate);
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,65 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "audio/Converter.hpp"
+#include "audio/Decoder.hpp"
+
+#include <ogg/ogg.h>
+#include <opus.h>
+
+#include <optional>
+#include <vector>
+
+namespace jar::audio {
+
+/**
+ * Streaming decoder of Opus audio in Ogg container (mono or stereo stream).
+ */
+class OggOpusDecoder final : public Decoder {
+public:
+    OggOpusDecoder();
+
+    ~OggOpusDecoder() final;
+
+    [[nodiscard]] std::error_code
+    decode(std::string_view input, std::string& output) final;
+
+    [[nodiscard]] std::error_code
+    finalize(std::string& output) final;
+
+private:
+    [[nodiscard]] std::error_code
+    handlePacket(const ogg_packet& packet, std::string& output);
+
+    [[nodiscard]] std::error_code
+    parseHeader(const ogg_packet& packet);
+
+    [[nodiscard]] std::error_code
+    decodePacket(const ogg_packet& packet, std::string& output);
+
+private:
+    ogg_sync_state _sync{};
+    ogg_stream_state _stream{};
+    bool _hasStream{};
+    std::size_t _packets{};
+    ::OpusDecoder* _decoder{};
+    std::uint16_t _channels{};
+    std::size_t _preSkip{};
+    std::optional<Converter> _converter;
+    std::vector<float> _samples;
+};
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,58 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace jar::audio {
+
+/**
+ * Streaming rational (L/M) sample rate converter based on polyphase FIR filter.
+ *
+ * The coefficients of each phase are stored contiguously and reversed, so computing one
+ * output sample is a plain dot product over contiguous memory which compiler vectorizes.
+ */
+class PolyphaseResampler {
+public:
+    PolyphaseResampler(std::uint32_t inputRate, std::uint32_t outputRate);
+
+    void
+    process(std::span<const float> input, std::vector<float>& output);
+
+    /* Pushes out samples delayed by the filter upon the end of input */
+    void
+    flush(std::vector<float>& output);
+
+    [[nodiscard]] std::size_t
+    taps() const;
+
+    [[nodiscard]] std::uint32_t
+    upFactor() const;
+
+    [[nodiscard]] std::uint32_t
+    downFactor() const;
+
+private:
+    std::uint32_t _up{};
+    std::uint32_t _down{};
+    std::size_t _taps{};
+    std::vector<float> _coeffs;
+    std::vector<float> _history;
+    std::uint64_t _pos{};
+};
+
+} // namespace jar::audio
\ No newline at end of file
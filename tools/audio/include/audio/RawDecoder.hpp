@@ -0,0 +1,41 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "audio/Converter.hpp"
+#include "audio/Decoder.hpp"
+
+#include <optional>
+#include <vector>
+
+namespace jar::audio {
+
+class RawDecoder final : public Decoder {
+public:
+    explicit RawDecoder(const Format& format);
+
+    [[nodiscard]] std::error_code
+    decode(std::string_view input, std::string& output) final;
+
+    [[nodiscard]] std::error_code
+    finalize(std::string& output) final;
+
+private:
+    std::optional<Converter> _converter;
+    std::string _pending;
+    std::vector<float> _samples;
+};
+
+} // namespace jar::audio
\ No newline at end of file
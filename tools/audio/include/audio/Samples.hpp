@@ -0,0 +1,32 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace jar::audio {
+
+enum class SampleFormat { U8, S16, S24, S32, F32, F64 };
+
+[[nodiscard]] std::size_t
+sampleSize(SampleFormat format);
+
+/* Converts little-endian encoded samples into floating point samples in range [-1, 1] */
+void
+toFloat(SampleFormat format, std::string_view input, std::vector<float>& output);
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,59 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "audio/Converter.hpp"
+#include "audio/Decoder.hpp"
+#include "audio/Samples.hpp"
+
+#include <optional>
+#include <vector>
+
+namespace jar::audio {
+
+/**
+ * Streaming RIFF/WAVE decoder of PCM (8/16/24/32 bits) and IEEE float data.
+ */
+class WavDecoder final : public Decoder {
+public:
+    WavDecoder() = default;
+
+    [[nodiscard]] std::error_code
+    decode(std::string_view input, std::string& output) final;
+
+    [[nodiscard]] std::error_code
+    finalize(std::string& output) final;
+
+private:
+    enum class State { Riff, Chunk, Format, Skip, Data };
+
+    [[nodiscard]] std::error_code
+    parse(std::size_t& offset, std::string& output);
+
+    [[nodiscard]] std::error_code
+    parseFormat(std::string_view chunk);
+
+private:
+    State _state{State::Riff};
+    std::string _pending;
+    std::uint32_t _chunkSize{};
+    std::uint64_t _remaining{};
+    SampleFormat _sampleFormat{SampleFormat::S16};
+    std::size_t _frameSize{};
+    std::optional<Converter> _converter;
+    std::vector<float> _samples;
+};
+
+} // namespace jar::audio
\ No newline at end of file
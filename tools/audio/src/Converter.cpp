@@ -0,0 +1,101 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "audio/Converter.hpp"
+
+#include "audio/Format.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace jar::audio {
+
+Converter::Converter(std::uint32_t sampleRate, std::uint16_t channels)
+    : _sampleRate{sampleRate}
+    , _channels{channels}
+{
+    BOOST_ASSERT(_channels > 0);
+    if (_sampleRate != kTargetSampleRate) {
+        _resampler.emplace(_sampleRate, kTargetSampleRate);
+    }
+}
+
+void
+Converter::convert(std::span<const float> samples, std::string& output)
+{
+    BOOST_ASSERT(samples.size() % _channels == 0);
+
+    if (_channels > 1) {
+        const std::size_t frames = samples.size() / _channels;
+        const float gain = 1.0f / static_cast<float>(_channels);
+        _mixed.resize(frames);
+        for (std::size_t frame = 0; frame < frames; ++frame) {
+            float sum{};
+            for (std::size_t ch = 0; ch < _channels; ++ch) {
+                sum += samples[frame * _channels + ch];
+            }
+            _mixed[frame] = sum * gain;
+        }
+        samples = _mixed;
+    }
+
+    if (_resampler) {
+        _resampled.clear();
+        _resampler->process(samples, _resampled);
+        samples = _resampled;
+    }
+
+    quantize(samples, output);
+}
+
+void
+Converter::flush(std::string& output)
+{
+    if (_resampler) {
+        _resampled.clear();
+        _resampler->flush(_resampled);
+        quantize(_resampled, output);
+    }
+}
+
+std::uint32_t
+Converter::sampleRate() const
+{
+    return _sampleRate;
+}
+
+std::uint16_t
+Converter::channels() const
+{
+    return _channels;
+}
+
+void
+Converter::quantize(std::span<const float> samples, std::string& output)
+{
+    const std::size_t offset = output.size();
+    output.resize(offset + samples.size() * sizeof(std::int16_t));
+    auto* data = reinterpret_cast<unsigned char*>(output.data() + offset);
+    for (const float sample : samples) {
+        const auto value = static_cast<std::int16_t>(
+            std::lrint(std::clamp(sample * 32768.0f, -32768.0f, 32767.0f)));
+        const auto bits = static_cast<std::uint16_t>(value);
+        *data++ = static_cast<unsigned char>(bits & 0xFF);
+        *data++ = static_cast<unsigned char>(bits >> 8);
+    }
+}
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,46 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "audio/Decoder.hpp"
+
+#include "audio/RawDecoder.hpp"
+#include "audio/WavDecoder.hpp"
+#include "rintento/Options.hpp"
+#ifdef ENABLE_AUDIO_CODECS
+#include "audio/FlacDecoder.hpp"
+#include "audio/OggOpusDecoder.hpp"
+#endif
+
+namespace jar::audio {
+
+Decoder::Ptr
+Decoder::create(const Format& format)
+{
+    switch (format.codec) {
+    case Codec::Raw:
+        return std::make_unique<RawDecoder>(format);
+    case Codec::Wav:
+        return std::make_unique<WavDecoder>();
+#ifdef ENABLE_AUDIO_CODECS
+    case Codec::Flac:
+        return std::make_unique<FlacDecoder>();
+    case Codec::Opus:
+        return std::make_unique<OggOpusDecoder>();
+#endif
+    default:
+        return {};
+    }
+}
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,333 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "audio/FlacDecoder.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace jar::audio {
+
+namespace {
+
+constexpr std::string_view kMagic{"fLaC"};
+constexpr std::size_t kMetadataHeaderSize{4};
+/* The header with sync code, fixed fields, coded number, optional fields and CRC */
+constexpr std::size_t kMinFrameHeaderSize{6};
+constexpr std::size_t kMaxFrameHeaderSize{16};
+/* The frame footer (CRC-16) and subframe headers of up to 8 channels (with wasted bits) */
+constexpr std::size_t kMaxFrameOverhead{kMaxFrameHeaderSize + 2 + 8 * 8};
+/* The limit of metadata blocks kept before the first frame (e.g. no picture is expected) */
+constexpr std::size_t kMaxMetadataSize{1024 * 1024};
+
+enum class HeaderStatus { Valid, Invalid, Incomplete };
+
+std::uint8_t
+crc8(const unsigned char* data, std::size_t size)
+{
+    std::uint8_t crc{};
+    for (std::size_t n = 0; n < size; ++n) {
+        crc ^= data[n];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = static_cast<std::uint8_t>((crc & 0x80) ? (crc << 1) ^ 0x07 : (crc << 1));
+        }
+    }
+    return crc;
+}
+
+HeaderStatus
+checkFrameHeader(const unsigned char* data, std::size_t size)
+{
+    if (size < 4) {
+        return HeaderStatus::Incomplete;
+    }
+    if (data[0] != 0xFF or (data[1] & 0xFE) != 0xF8) {
+        return HeaderStatus::Invalid;
+    }
+    const unsigned blockSizeCode = data[2] >> 4;
+    const unsigned sampleRateCode = data[2] & 0x0F;
+    const unsigned channelsCode = data[3] >> 4;
+    if (blockSizeCode == 0 or sampleRateCode == 0x0F or channelsCode > 10 or (data[3] & 0x01)) {
+        return HeaderStatus::Invalid;
+    }
+
+    /* The frame or sample number coded like UTF-8 */
+    std::size_t length = 4;
+    if (size <= length) {
+        return HeaderStatus::Incomplete;
+    }
+    const unsigned char lead = data[length];
+    const auto extra = static_cast<std::size_t>(std::countl_one(lead));
+    if (extra == 1 or extra > 7) {
+        return HeaderStatus::Invalid;
+    }
+    const std::size_t numberSize = (extra == 0) ? 1 : extra;
+    if (size < length + numberSize) {
+        return HeaderStatus::Incomplete;
+    }
+    for (std::size_t n = 1; n < numberSize; ++n) {
+        if ((data[length + n] & 0xC0) != 0x80) {
+            return HeaderStatus::Invalid;
+        }
+    }
+    length += numberSize;
+
+    if (blockSizeCode == 6) {
+        length += 1;
+    } else if (blockSizeCode == 7) {
+        length += 2;
+    }
+    if (sampleRateCode == 12) {
+        length += 1;
+    } else if (sampleRateCode == 13 or sampleRateCode == 14) {
+        length += 2;
+    }
+    if (size < length + 1) {
+        return HeaderStatus::Incomplete;
+    }
+    return (crc8(data, length) == data[length]) ? HeaderStatus::Valid : HeaderStatus::Invalid;
+}
+
+} // namespace
+
+FlacDecoder::FlacDecoder()
+    : _decoder{FLAC__stream_decoder_new()}
+{
+    if (not _decoder) {
+        throw std::runtime_error{"Unable to create FLAC decoder"};
+    }
+    const auto status = FLAC__stream_decoder_init_stream(
+        _decoder, &onRead, nullptr, nullptr, nullptr, nullptr, &onWrite, &onMetadata, &onError, this);
+    if (status != FLAC__STREAM_DECODER_INIT_STATUS_OK) {
+        FLAC__stream_decoder_delete(_decoder);
+        throw std::runtime_error{"Unable to initialize FLAC decoder"};
+    }
+}
+
+FlacDecoder::~FlacDecoder()
+{
+    FLAC__stream_decoder_finish(_decoder);
+    FLAC__stream_decoder_delete(_decoder);
+}
+
+std::error_code
+FlacDecoder::decode(std::string_view input, std::string& output)
+{
+    _pending.append(input);
+    _output = &output;
+
+    if (not _hasMetadata) {
+        std::error_code ec;
+        const auto size = metadataSize(ec);
+        if (ec or not size) {
+            return ec;
+        }
+        if (ec = decodeMetadata(*size); ec) {
+            return ec;
+        }
+    }
+
+    /* Decode every frame which is followed by the header of next frame */
+    std::size_t begin{};
+    while (const auto next = findFrame(begin + kMinFrameHeaderSize, _scanned)) {
+        if (auto ec = decodeFrame(*next - begin); ec) {
+            return ec;
+        }
+        begin = *next;
+    }
+    _pending.erase(0, begin);
+    _scanned -= begin;
+    /* The pending data not followed by the header of next frame is over the largest frame
+       (e.g. the garbage without any frame sync), so it's not kept growing */
+    if (_pending.size() > _maxFrameSize + kMaxFrameHeaderSize) {
+        return std::make_error_code(std::errc::illegal_byte_sequence);
+    }
+    return {};
+}
+
+std::error_code
+FlacDecoder::finalize(std::string& output)
+{
+    _output = &output;
+    if (not _hasMetadata) {
+        return std::make_error_code(std::errc::illegal_byte_sequence);
+    }
+    if (not _pending.empty()) {
+        if (auto ec = decodeFrame(_pending.size()); ec) {
+            return ec;
+        }
+        _pending.clear();
+    }
+    _converter->flush(output);
+    return {};
+}
+
+std::optional<std::size_t>
+FlacDecoder::metadataSize(std::error_code& ec) const
+{
+    const std::string_view data{_pending};
+    if (data.size() < kMagic.size()) {
+        return std::nullopt;
+    }
+    if (data.substr(0, kMagic.size()) != kMagic) {
+        ec = std::make_error_code(std::errc::illegal_byte_sequence);
+        return std::nullopt;
+    }
+
+    std::size_t offset = kMagic.size();
+    while (offset + kMetadataHeaderSize <= data.size()) {
+        const auto* header = reinterpret_cast<const unsigned char*>(data.data() + offset);
+        const bool isLast = (header[0] & 0x80);
+        const std::size_t length = (header[1] << 16) | (header[2] << 8) | header[3];
+        offset += kMetadataHeaderSize + length;
+        if (offset > kMaxMetadataSize) {
+            ec = std::make_error_code(std::errc::file_too_large);
+            return std::nullopt;
+        }
+        if (isLast) {
+            return (offset <= data.size()) ? std::optional{offset} : std::nullopt;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<std::size_t>
+FlacDecoder::findFrame(std::size_t from, std::size_t& scanned) const
+{
+    const auto* data = reinterpret_cast<const unsigned char*>(_pending.data());
+    const std::size_t size = _pending.size();
+    for (std::size_t pos = std::max(from, scanned); pos + 1 < size; ++pos) {
+        if (data[pos] != 0xFF or (data[pos + 1] & 0xFE) != 0xF8) {
+            continue;
+        }
+        const auto status = checkFrameHeader(data + pos, std::min(size - pos, kMaxFrameHeaderSize));
+        if (status == HeaderStatus::Valid) {
+            scanned = pos + 1;
+            return pos;
+        }
+        if (status == HeaderStatus::Incomplete) {
+            scanned = pos;
+            return std::nullopt;
+        }
+    }
+    scanned = (size > 0) ? size - 1 : 0;
+    return std::nullopt;
+}
+
+std::error_code
+FlacDecoder::decodeMetadata(std::size_t size)
+{
+    _feed = std::string_view{_pending}.substr(0, size);
+    if (not FLAC__stream_decoder_process_until_end_of_metadata(_decoder) or _error) {
+        return _error ? _error : std::make_error_code(std::errc::illegal_byte_sequence);
+    }
+    if (not _converter) {
+        /* Missing mandatory STREAMINFO block */
+        return std::make_error_code(std::errc::illegal_byte_sequence);
+    }
+    _pending.erase(0, size);
+    _hasMetadata = true;
+    return {};
+}
+
+std::error_code
+FlacDecoder::decodeFrame(std::size_t size)
+{
+    _feed = std::string_view{_pending}.substr(0, size);
+    if (not FLAC__stream_decoder_process_single(_decoder)) {
+        /* Drop corrupted frame and resynchronize on the next one */
+        FLAC__stream_decoder_flush(_decoder);
+    }
+    _feed = {};
+    return std::exchange(_error, {});
+}
+
+FLAC__StreamDecoderReadStatus
+FlacDecoder::onRead(const FLAC__StreamDecoder* /*decoder*/,
+                    FLAC__byte buffer[],
+                    size_t* bytes,
+                    void* data)
+{
+    auto* self = static_cast<FlacDecoder*>(data);
+    if (self->_feed.empty()) {
+        /* Decoder can't wait for more data, so incomplete frame is aborted */
+        *bytes = 0;
+        return FLAC__STREAM_DECODER_READ_STATUS_ABORT;
+    }
+    const std::size_t size = std::min(*bytes, self->_feed.size());
+    std::memcpy(buffer, self->_feed.data(), size);
+    self->_feed.remove_prefix(size);
+    *bytes = size;
+    return FLAC__STREAM_DECODER_READ_STATUS_CONTINUE;
+}
+
+FLAC__StreamDecoderWriteStatus
+FlacDecoder::onWrite(const FLAC__StreamDecoder* /*decoder*/,
+                     const FLAC__Frame* frame,
+                     const FLAC__int32* const buffer[],
+                     void* data)
+{
+    auto* self = static_cast<FlacDecoder*>(data);
+    const std::size_t channels = frame->header.channels;
+    const std::size_t blockSize = frame->header.blocksize;
+    if (channels != self->_converter->channels()) {
+        self->_error = std::make_error_code(std::errc::illegal_byte_sequence);
+        return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+    }
+
+    const float scale = 1.0f / static_cast<float>(1u << (frame->header.bits_per_sample - 1));
+    self->_samples.resize(blockSize * channels);
+    for (std::size_t n = 0; n < blockSize; ++n) {
+        for (std::size_t ch = 0; ch < channels; ++ch) {
+            self->_samples[n * channels + ch] = static_cast<float>(buffer[ch][n]) * scale;
+        }
+    }
+    self->_converter->convert(self->_samples, *self->_output);
+    return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+}
+
+void
+FlacDecoder::onMetadata(const FLAC__StreamDecoder* /*decoder*/,
+                        const FLAC__StreamMetadata* metadata,
+                        void* data)
+{
+    auto* self = static_cast<FlacDecoder*>(data);
+    if (metadata->type != FLAC__METADATA_TYPE_STREAMINFO) {
+        return;
+    }
+    const auto& info = metadata->data.stream_info;
+    if (not isSampleRateSupported(info.sample_rate) or info.bits_per_sample > 32) {
+        self->_error = std::make_error_code(std::errc::not_supported);
+        return;
+    }
+    /* The largest frame is the verbatim one (the max frame size given by stream info is zero
+       if the encoder was streaming, e.g. to stdout) */
+    self->_maxFrameSize
+        = static_cast<std::size_t>(info.max_blocksize) * info.channels * info.bits_per_sample / 8
+          + kMaxFrameOverhead;
+    self->_converter.emplace(info.sample_rate, static_cast<std::uint16_t>(info.channels));
+}
+
+void
+FlacDecoder::onError(const FLAC__StreamDecoder* /*decoder*/,
+                     FLAC__StreamDecoderErrorStatus /*status*/,
+                     void* /*data*/)
+{
+    /* Decoder recovers by itself by searching for the next frame */
+}
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,163 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "audio/Format.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+
+namespace jar::audio {
+
+namespace {
+
+constexpr std::uint32_t kMinSampleRate{8000};
+constexpr std::uint32_t kMaxSampleRate{192000};
+constexpr std::uint16_t kMaxChannels{8};
+
+std::string_view
+trim(std::string_view input)
+{
+    while (not input.empty() and std::isspace(static_cast<unsigned char>(input.front()))) {
+        input.remove_prefix(1);
+    }
+    while (not input.empty() and std::isspace(static_cast<unsigned char>(input.back()))) {
+        input.remove_suffix(1);
+    }
+    return input;
+}
+
+bool
+iequals(std::string_view lhs, std::string_view rhs)
+{
+    return std::ranges::equal(lhs, rhs, [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a))
+               == std::tolower(static_cast<unsigned char>(b));
+    });
+}
+
+template<typename T>
+bool
+parseNumber(std::string_view input, T& output)
+{
+    const auto [ptr, ec] = std::from_chars(input.data(), input.data() + input.size(), output);
+    return (ec == std::errc{} and ptr == input.data() + input.size());
+}
+
+std::optional<Codec>
+parseMediaType(std::string_view mediaType)
+{
+    if (iequals(mediaType, "audio/raw") or iequals(mediaType, "audio/x-raw")
+        or iequals(mediaType, "application/octet-stream")) {
+        return Codec::Raw;
+    }
+    if (iequals(mediaType, "audio/wav") or iequals(mediaType, "audio/x-wav")
+        or iequals(mediaType, "audio/wave") or iequals(mediaType, "audio/vnd.wave")) {
+        return Codec::Wav;
+    }
+    if (iequals(mediaType, "audio/flac") or iequals(mediaType, "audio/x-flac")) {
+        return Codec::Flac;
+    }
+    if (iequals(mediaType, "audio/ogg") or iequals(mediaType, "audio/opus")) {
+        return Codec::Opus;
+    }
+    return std::nullopt;
+}
+
+bool
+applyParameter(Format& format, std::string_view name, std::string_view value)
+{
+    if (value.size() >= 2 and value.front() == '"' and value.back() == '"') {
+        value = value.substr(1, value.size() - 2);
+    }
+
+    if (iequals(name, "codecs")) {
+        return (format.codec != Codec::Opus or iequals(value, "opus"));
+    }
+    if (format.codec != Codec::Raw) {
+        /* Parameters of containers are taken from the stream itself */
+        return true;
+    }
+    if (iequals(name, "rate")) {
+        return parseNumber(value, format.sampleRate);
+    }
+    if (iequals(name, "channels")) {
+        return parseNumber(value, format.channels);
+    }
+    if (iequals(name, "encoding")) {
+        return iequals(value, "signed-integer");
+    }
+    if (iequals(name, "bits")) {
+        return (value == "16");
+    }
+    if (iequals(name, "endian")) {
+        return iequals(value, "little");
+    }
+    return true;
+}
+
+} // namespace
+
+std::optional<Format>
+parseContentType(std::string_view contentType)
+{
+    contentType = trim(contentType);
+    if (contentType.empty()) {
+        return Format{};
+    }
+
+    auto pos = contentType.find(';');
+    const auto codec = parseMediaType(trim(contentType.substr(0, pos)));
+    if (not codec) {
+        return std::nullopt;
+    }
+
+    Format format{.codec = *codec};
+    while (pos != std::string_view::npos) {
+        contentType.remove_prefix(pos + 1);
+        pos = contentType.find(';');
+        const auto parameter = trim(contentType.substr(0, pos));
+        if (parameter.empty()) {
+            continue;
+        }
+        const auto eq = parameter.find('=');
+        if (eq == std::string_view::npos) {
+            return std::nullopt;
+        }
+        if (not applyParameter(format, trim(parameter.substr(0, eq)), trim(parameter.substr(eq + 1)))) {
+            return std::nullopt;
+        }
+    }
+
+    if (not isSampleRateSupported(format.sampleRate) or format.channels == 0
+        or format.channels > kMaxChannels) {
+        return std::nullopt;
+    }
+    return format;
+}
+
+bool
+isNative(const Format& format)
+{
+    return (format.codec == Codec::Raw and format.sampleRate == kTargetSampleRate
+            and format.channels == kTargetChannels);
+}
+
+bool
+isSampleRateSupported(std::uint32_t sampleRate)
+{
+    return (sampleRate >= kMinSampleRate and sampleRate <= kMaxSampleRate);
+}
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,170 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "audio/OggOpusDecoder.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+
+namespace jar::audio {
+
+namespace {
+
+/* Opus is always decoded at 48kHz regardless of original input rate */
+constexpr std::uint32_t kOpusSampleRate{48000};
+/* The maximum duration of Opus packet is 120ms */
+constexpr int kMaxFrameSize{kOpusSampleRate * 120 / 1000};
+constexpr std::size_t kHeaderSize{19};
+constexpr std::string_view kHeadMagic{"OpusHead"};
+
+} // namespace
+
+OggOpusDecoder::OggOpusDecoder()
+{
+    ogg_sync_init(&_sync);
+}
+
+OggOpusDecoder::~OggOpusDecoder()
+{
+    if (_decoder) {
+        opus_decoder_destroy(_decoder);
+    }
+    if (_hasStream) {
+        ogg_stream_clear(&_stream);
+    }
+    ogg_sync_clear(&_sync);
+}
+
+std::error_code
+OggOpusDecoder::decode(std::string_view input, std::string& output)
+{
+    char* buffer = ogg_sync_buffer(&_sync, static_cast<long>(input.size()));
+    if (not buffer) {
+        return std::make_error_code(std::errc::not_enough_memory);
+    }
+    std::memcpy(buffer, input.data(), input.size());
+    ogg_sync_wrote(&_sync, static_cast<long>(input.size()));
+
+    ogg_page page;
+    while (ogg_sync_pageout(&_sync, &page) == 1) {
+        if (not _hasStream) {
+            ogg_stream_init(&_stream, ogg_page_serialno(&page));
+            _hasStream = true;
+        }
+        if (ogg_page_serialno(&page) != _stream.serialno) {
+            /* Skip pages of multiplexed logical streams */
+            continue;
+        }
+        if (ogg_stream_pagein(&_stream, &page) != 0) {
+            return std::make_error_code(std::errc::illegal_byte_sequence);
+        }
+
+        ogg_packet packet;
+        while (const int rv = ogg_stream_packetout(&_stream, &packet)) {
+            if (rv < 0) {
+                /* Skip the gap in data */
+                continue;
+            }
+            if (auto ec = handlePacket(packet, output); ec) {
+                return ec;
+            }
+        }
+    }
+    return {};
+}
+
+std::error_code
+OggOpusDecoder::finalize(std::string& output)
+{
+    if (not _converter) {
+        return std::make_error_code(std::errc::illegal_byte_sequence);
+    }
+    _converter->flush(output);
+    return {};
+}
+
+std::error_code
+OggOpusDecoder::handlePacket(const ogg_packet& packet, std::string& output)
+{
+    switch (_packets++) {
+    case 0:
+        return parseHeader(packet);
+    case 1:
+        /* Skip comment header */
+        return {};
+    default:
+        return decodePacket(packet, output);
+    }
+}
+
+std::error_code
+OggOpusDecoder::parseHeader(const ogg_packet& packet)
+{
+    const std::span<const unsigned char> data{packet.packet, static_cast<std::size_t>(packet.bytes)};
+    if (data.size() < kHeaderSize
+        or not std::ranges::equal(data.first(kHeadMagic.size()), kHeadMagic,
+                                  [](unsigned char a, char b) { return a == static_cast<unsigned char>(b); })) {
+        return std::make_error_code(std::errc::illegal_byte_sequence);
+    }
+
+    const unsigned version = data[8];
+    const unsigned channels = data[9];
+    const unsigned mappingFamily = data[18];
+    if ((version >> 4) != 0) {
+        return std::make_error_code(std::errc::not_supported);
+    }
+    if (mappingFamily != 0 or channels == 0 or channels > 2) {
+        /* Only mono and stereo streams are supported */
+        return std::make_error_code(std::errc::not_supported);
+    }
+
+    int error{};
+    _decoder = opus_decoder_create(kOpusSampleRate, static_cast<int>(channels), &error);
+    if (error != OPUS_OK) {
+        _decoder = nullptr;
+        return std::make_error_code(std::errc::not_enough_memory);
+    }
+    _channels = static_cast<std::uint16_t>(channels);
+    _preSkip = static_cast<std::size_t>(data[10] | (data[11] << 8));
+    _converter.emplace(kOpusSampleRate, _channels);
+    return {};
+}
+
+std::error_code
+OggOpusDecoder::decodePacket(const ogg_packet& packet, std::string& output)
+{
+    _samples.resize(static_cast<std::size_t>(kMaxFrameSize) * _channels);
+    const int count = opus_decode_float(_decoder,
+                                        packet.packet,
+                                        static_cast<opus_int32>(packet.bytes),
+                                        _samples.data(),
+                                        kMaxFrameSize,
+                                        0);
+    if (count < 0) {
+        return std::make_error_code(std::errc::illegal_byte_sequence);
+    }
+
+    /* Skip samples produced by encoder warm-up */
+    const auto skip = std::min(_preSkip, static_cast<std::size_t>(count));
+    _preSkip -= skip;
+    const std::span<const float> samples{_samples.data() + skip * _channels,
+                                         (static_cast<std::size_t>(count) - skip) * _channels};
+    if (not samples.empty()) {
+        _converter->convert(samples, output);
+    }
+    return {};
+}
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,148 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "audio/PolyphaseResampler.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+
+namespace jar::audio {
+
+namespace {
+
+/* Number of filter taps per phase per unit of decimation factor */
+constexpr std::size_t kTapsPerPhase{32};
+/* Number of independent accumulators (multiple of widest SIMD register width in floats) */
+constexpr std::size_t kLanes{8};
+/* Cutoff frequency relative to the Nyquist frequency of lowest rate */
+constexpr double kCutoff{0.9};
+
+float
+dot(const float* coeffs, const float* samples, std::size_t size)
+{
+    BOOST_ASSERT(size % kLanes == 0);
+    /* Independent accumulators break the dependency chain, so loop is turned into SIMD */
+    std::array<float, kLanes> acc{};
+    for (std::size_t i = 0; i < size; i += kLanes) {
+        for (std::size_t k = 0; k < kLanes; ++k) {
+            acc[k] += coeffs[i + k] * samples[i + k];
+        }
+    }
+    return std::accumulate(acc.cbegin(), acc.cend(), 0.0f);
+}
+
+double
+sinc(double x)
+{
+    if (x == 0.0) {
+        return 1.0;
+    }
+    return std::sin(std::numbers::pi * x) / (std::numbers::pi * x);
+}
+
+double
+blackman(std::size_t n, std::size_t size)
+{
+    const double a = 2.0 * std::numbers::pi * static_cast<double>(n) / static_cast<double>(size - 1);
+    return 0.42 - 0.5 * std::cos(a) + 0.08 * std::cos(2.0 * a);
+}
+
+} // namespace
+
+PolyphaseResampler::PolyphaseResampler(std::uint32_t inputRate, std::uint32_t outputRate)
+{
+    BOOST_ASSERT(inputRate > 0 and outputRate > 0);
+
+    const auto divisor = std::gcd(inputRate, outputRate);
+    _up = outputRate / divisor;
+    _down = inputRate / divisor;
+
+    /* The longer filter is necessary for the narrower transition band while decimating */
+    const std::size_t ratio = (_down + _up - 1) / _up;
+    _taps = (kTapsPerPhase * ratio + kLanes - 1) / kLanes * kLanes;
+
+    /* Prototype low-pass filter designed at upsampled rate */
+    const std::size_t size = _taps * _up;
+    const double cutoff = kCutoff * 0.5 / static_cast<double>(std::max(_up, _down));
+    const double center = static_cast<double>(size - 1) / 2.0;
+    std::vector<double> prototype(size);
+    for (std::size_t n = 0; n < size; ++n) {
+        const double t = static_cast<double>(n) - center;
+        prototype[n] = 2.0 * cutoff * sinc(2.0 * cutoff * t) * blackman(n, size) * _up;
+    }
+
+    /* Split into phases with coefficients in reverse order relative to input samples */
+    _coeffs.resize(size);
+    for (std::size_t phase = 0; phase < _up; ++phase) {
+        for (std::size_t tap = 0; tap < _taps; ++tap) {
+            _coeffs[phase * _taps + tap]
+                = static_cast<float>(prototype[phase + (_taps - 1 - tap) * _up]);
+        }
+    }
+
+    _history.assign(_taps - 1, 0.0f);
+    _pos = static_cast<std::uint64_t>(_taps - 1) * _up;
+}
+
+void
+PolyphaseResampler::process(std::span<const float> input, std::vector<float>& output)
+{
+    _history.insert(_history.end(), input.begin(), input.end());
+
+    const std::size_t size = _history.size();
+    output.reserve(output.size() + (input.size() * _up) / _down + 1);
+    for (std::size_t index = _pos / _up; index < size; index = _pos / _up) {
+        const std::size_t phase = _pos % _up;
+        const float* samples = _history.data() + index + 1 - _taps;
+        output.push_back(dot(_coeffs.data() + phase * _taps, samples, _taps));
+        _pos += _down;
+    }
+
+    /* Keep only samples needed by the filter to produce next output sample */
+    const std::size_t drop = size - (_taps - 1);
+    _history.erase(_history.begin(), _history.begin() + static_cast<std::ptrdiff_t>(drop));
+    _pos -= static_cast<std::uint64_t>(drop) * _up;
+}
+
+void
+PolyphaseResampler::flush(std::vector<float>& output)
+{
+    const std::vector<float> silence(_taps / 2 + 1, 0.0f);
+    process(silence, output);
+}
+
+std::size_t
+PolyphaseResampler::taps() const
+{
+    return _taps;
+}
+
+std::uint32_t
+PolyphaseResampler::upFactor() const
+{
+    return _up;
+}
+
+std::uint32_t
+PolyphaseResampler::downFactor() const
+{
+    return _down;
+}
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,57 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "audio/RawDecoder.hpp"
+
+#include "audio/Samples.hpp"
+
+namespace jar::audio {
+
+RawDecoder::RawDecoder(const Format& format)
+{
+    if (not isNative(format)) {
+        _converter.emplace(format.sampleRate, format.channels);
+    }
+}
+
+std::error_code
+RawDecoder::decode(std::string_view input, std::string& output)
+{
+    if (not _converter) {
+        /* Native format is passed through as is */
+        output.append(input);
+        return {};
+    }
+
+    _pending.append(input);
+    const std::size_t frameSize = _converter->channels() * sampleSize(SampleFormat::S16);
+    const std::size_t size = _pending.size() / frameSize * frameSize;
+    if (size > 0) {
+        toFloat(SampleFormat::S16, std::string_view{_pending}.substr(0, size), _samples);
+        _converter->convert(_samples, output);
+        _pending.erase(0, size);
+    }
+    return {};
+}
+
+std::error_code
+RawDecoder::finalize(std::string& output)
+{
+    if (_converter) {
+        _converter->flush(output);
+    }
+    return {};
+}
+
+} // namespace jar::audio
\ No newline at end of file
@@ -0,0 +1,97 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "audio/Samples.hpp"
+
+#include <bit>
+#include <type_traits>
+
+namespace jar::audio {
+
+namespace {
+
+template<typename T>
+T
+load(const unsigned char* data)
+{
+    using Bits = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+    Bits bits{};
+    for (std::size_t n = 0; n < sizeof(T); ++n) {
+        bits |= static_cast<Bits>(data[n]) << (8 * n);
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::bit_cast<T>(bits);
+    } else {
+        return static_cast<T>(bits);
+    }
+}
+
+} // namespace
+
+std::size_t
+sampleSize(SampleFormat format)
+{
+    switch (format) {
+    case SampleFormat::U8:
+        return 1;
+    case SampleFormat::S16:
+        return 2;
+    case SampleFormat::S24:
+        return 3;
+    case SampleFormat::S32:
+    case SampleFormat::F32:
+        return 4;
+    case SampleFormat::F64:
+        return 8;
+    }
+    return 0;
+}
+
+void
+toFloat(SampleFormat format, std::string_view input, std::vector<float>& output)
+{
+    const std::size_t size = sampleSize(format);
+    const std::size_t count = input.size() / size;
+    const auto* data = reinterpret_cast<const unsigned char*>(input.data());
+
+    output.resize(count);
+    for (std::size_t n = 0; n < count; ++n, data += size) {
+        switch (format) {
+        case SampleFormat::U8:
+            output[n] = (static_cast<float>(data[0]) - 128.0f) / 128.0f;
+            break;
+        case SampleFormat::S16:
+            output[n] = static_cast<float>(load<std::int16_t>(data)) / 32768.0f;
+            break;
+        case SampleFormat::S24: {
+            const std::uint32_t bits = data[0] | (data[1] << 8) | (data[2] << 16);
+            /* Shift into the upper bits of 32-bit integer to extend the sign */
+            const auto value = static_cast<std::int32_t>(bits << 8) >> 8;
+            output[n] = static_cast<float>(value) / 8388608.0f;
+            break;
+        }
+        case SampleFormat::S32:
+            output[n] = static_cast<float>(load<std::int32_t>(data)) / 2147483648.0f;
+            break;
+        case SampleFormat::F32:
+            output[n] = load<float>(data);
+            break;
+        case SampleFormat::F64:
+            output[n] = static_cast<float>(load<double>(data));
+            break;
+        }
+    }
+}
+
+} // namespace jar::audio
\ No newline at end of file
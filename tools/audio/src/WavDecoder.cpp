@@ -0,0 +1,231 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "audio/WavDecoder.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace jar::audio {
+
+namespace {
+
+constexpr std::size_t kRiffHeaderSize{12};
+constexpr std::size_t kChunkHeaderSize{8};
+constexpr std::size_t kMinFormatSize{16};
+constexpr std::size_t kMaxFormatSize{1024};
+constexpr std::uint16_t kMaxChannels{8};
+
+constexpr std::uint16_t kFormatPcm{0x0001};
+constexpr std::uint16_t kFormatFloat{0x0003};
+constexpr std::uint16_t kFormatExtensible{0xFFFE};
+
+/* Streaming writers put placeholder instead of unknown data chunk size */
+constexpr std::uint32_t kUnknownSize{std::numeric_limits<std::uint32_t>::max()};
+/* The remaining size of data chunk running up to the end of upload */
+constexpr std::uint64_t kUntilEnd{std::numeric_limits<std::uint64_t>::max()};
+
+std::uint16_t
+readU16(std::string_view data, std::size_t offset)
+{
+    const auto* p = reinterpret_cast<const unsigned char*>(data.data() + offset);
+    return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+}
+
+std::uint32_t
+readU32(std::string_view data, std::size_t offset)
+{
+    const auto* p = reinterpret_cast<const unsigned char*>(data.data() + offset);
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8)
+           | (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+std::optional<SampleFormat>
+toSampleFormat(std::uint16_t format, std::uint16_t bits)
+{
+    if (format == kFormatPcm) {
+        switch (bits) {
+        case 8:
+            return SampleFormat::U8;
+        case 16:
+            return SampleFormat::S16;
+        case 24:
+            return SampleFormat::S24;
+        case 32:
+            return SampleFormat::S32;
+        default:
+            break;
+        }
+    }
+    if (format == kFormatFloat) {
+        switch (bits) {
+        case 32:
+            return SampleFormat::F32;
+        case 64:
+            return SampleFormat::F64;
+        default:
+            break;
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+std::error_code
+WavDecoder::decode(std::string_view input, std::string& output)
+{
+    _pending.append(input);
+    std::size_t offset{};
+    const auto ec = parse(offset, output);
+    _pending.erase(0, offset);
+    return ec;
+}
+
+std::error_code
+WavDecoder::finalize(std::string& output)
+{
+    if (not _converter) {
+        return std::make_error_code(std::errc::illegal_byte_sequence);
+    }
+    _converter->flush(output);
+    return {};
+}
+
+std::error_code
+WavDecoder::parse(std::size_t& offset, std::string& output)
+{
+    const std::string_view data{_pending};
+    while (offset < data.size()) {
+        const std::size_t available = data.size() - offset;
+        switch (_state) {
+        case State::Riff: {
+            if (available < kRiffHeaderSize) {
+                return {};
+            }
+            if (data.substr(offset, 4) != "RIFF" or data.substr(offset + 8, 4) != "WAVE") {
+                return std::make_error_code(std::errc::illegal_byte_sequence);
+            }
+            offset += kRiffHeaderSize;
+            _state = State::Chunk;
+            break;
+        }
+        case State::Chunk: {
+            if (available < kChunkHeaderSize) {
+                return {};
+            }
+            const auto id = data.substr(offset, 4);
+            _chunkSize = readU32(data, offset + 4);
+            offset += kChunkHeaderSize;
+            if (id == "fmt ") {
+                if (_chunkSize < kMinFormatSize or _chunkSize > kMaxFormatSize) {
+                    return std::make_error_code(std::errc::illegal_byte_sequence);
+                }
+                _state = State::Format;
+            } else if (id == "data") {
+                if (not _converter) {
+                    return std::make_error_code(std::errc::illegal_byte_sequence);
+                }
+                if (_chunkSize == 0 or _chunkSize == kUnknownSize) {
+                    /* The streaming WAV (e.g. written by arecord to stdout) has no size of data
+                       known upfront, so the data chunk is taken as the last one running up to
+                       the end of upload. The data is converted as it's given (not kept) */
+                    _remaining = kUntilEnd;
+                } else {
+                    _remaining = _chunkSize;
+                }
+                _state = State::Data;
+            } else {
+                _remaining = _chunkSize + (_chunkSize & 1);
+                _state = State::Skip;
+            }
+            break;
+        }
+        case State::Format: {
+            const std::size_t size = _chunkSize + (_chunkSize & 1);
+            if (available < size) {
+                return {};
+            }
+            if (auto ec = parseFormat(data.substr(offset, _chunkSize)); ec) {
+                return ec;
+            }
+            offset += size;
+            _state = State::Chunk;
+            break;
+        }
+        case State::Skip: {
+            const auto size = static_cast<std::size_t>(std::min<std::uint64_t>(available, _remaining));
+            offset += size;
+            _remaining -= size;
+            if (_remaining == 0) {
+                _state = State::Chunk;
+            }
+            break;
+        }
+        case State::Data: {
+            const auto usable = std::min<std::uint64_t>(available, _remaining);
+            const std::size_t size = static_cast<std::size_t>(usable) / _frameSize * _frameSize;
+            if (size == 0) {
+                if (_remaining < _frameSize) {
+                    /* Skip incomplete trailing frame and pad byte */
+                    _remaining += (_chunkSize & 1);
+                    _state = State::Skip;
+                    break;
+                }
+                return {};
+            }
+            toFloat(_sampleFormat, data.substr(offset, size), _samples);
+            _converter->convert(_samples, output);
+            offset += size;
+            _remaining -= size;
+            break;
+        }
+        }
+    }
+    return {};
+}
+
+std::error_code
+WavDecoder::parseFormat(std::string_view chunk)
+{
+    auto format = readU16(chunk, 0);
+    const auto channels = readU16(chunk, 2);
+    const auto sampleRate = readU32(chunk, 4);
+    const auto blockAlign = readU16(chunk, 12);
+    const auto bits = readU16(chunk, 14);
+
+    if (format == kFormatExtensible) {
+        /* The format code is the first two bytes of sub-format GUID */
+        if (chunk.size() < 40) {
+            return std::make_error_code(std::errc::illegal_byte_sequence);
+        }
+        format = readU16(chunk, 24);
+    }
+
+    const auto sampleFormat = toSampleFormat(format, bits);
+    if (not sampleFormat or channels == 0 or channels > kMaxChannels
+        or not isSampleRateSupported(sampleRate)) {
+        return std::make_error_code(std::errc::not_supported);
+    }
+    if (blockAlign != channels * sampleSize(*sampleFormat)) {
+        return std::make_error_code(std::errc::illegal_byte_sequence);
+    }
+
+    _sampleFormat = *sampleFormat;
+    _frameSize = blockAlign;
+    _converter.emplace(sampleRate, channels);
+    return {};
+}
+
+} // namespace jar::audio
\ No newline at end of file
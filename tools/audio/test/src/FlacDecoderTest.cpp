@@ -0,0 +1,79 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "audio/Decoder.hpp"
+
+#include <initializer_list>
+#include <string>
+
+using namespace jar;
+using namespace testing;
+
+namespace {
+
+std::string
+makeBytes(std::initializer_list<unsigned char> bytes)
+{
+    std::string output;
+    for (const auto byte : bytes) {
+        output.push_back(static_cast<char>(byte));
+    }
+    return output;
+}
+
+/* The stream marker and STREAMINFO block (4096 samples per block, 16 kHz, mono, 16 bits) */
+std::string
+makeHeader()
+{
+    std::string output{"fLaC"};
+    output.append(makeBytes({0x80, 0x00, 0x00, 0x22}));
+    output.append(makeBytes({0x10, 0x00, 0x10, 0x00}));
+    output.append(6, '\0');
+    output.append(makeBytes({0x03, 0xE8, 0x00, 0xF0}));
+    output.append(4 + 16, '\0');
+    return output;
+}
+
+} // namespace
+
+TEST(AudioFlacDecoderTest, NoFrameSync)
+{
+    auto decoder = audio::Decoder::create({.codec = audio::Codec::Flac});
+    ASSERT_TRUE(decoder);
+
+    std::string output;
+    ASSERT_FALSE(decoder->decode(makeHeader(), output));
+
+    /* The garbage without frame sync isn't kept past the largest frame */
+    const std::string garbage(1024, '\0');
+    std::error_code ec;
+    for (int n = 0; n < 64 and not ec; ++n) {
+        ec = decoder->decode(garbage, output);
+    }
+    EXPECT_EQ(ec, std::make_error_code(std::errc::illegal_byte_sequence));
+    EXPECT_THAT(output, IsEmpty());
+}
+
+TEST(AudioFlacDecoderTest, MetadataLimit)
+{
+    auto decoder = audio::Decoder::create({.codec = audio::Codec::Flac});
+    ASSERT_TRUE(decoder);
+
+    /* The metadata block of 16 MiB isn't waited for */
+    std::string output;
+    EXPECT_TRUE(decoder->decode("fLaC" + makeBytes({0x06, 0xFF, 0xFF, 0xFF}), output));
+}
\ No newline at end of file
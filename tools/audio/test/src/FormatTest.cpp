@@ -0,0 +1,68 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "audio/Format.hpp"
+
+using namespace jar;
+using namespace testing;
+
+TEST(AudioFormatTest, NativeByDefault)
+{
+    const auto format = audio::parseContentType("");
+    ASSERT_TRUE(format);
+    EXPECT_THAT(format->codec, Eq(audio::Codec::Raw));
+    EXPECT_TRUE(audio::isNative(*format));
+}
+
+TEST(AudioFormatTest, RawWithParameters)
+{
+    const auto format = audio::parseContentType(
+        "audio/raw; encoding=signed-integer; bits=16; rate=48000; channels=2; endian=little");
+    ASSERT_TRUE(format);
+    EXPECT_THAT(format->codec, Eq(audio::Codec::Raw));
+    EXPECT_THAT(format->sampleRate, Eq(48000));
+    EXPECT_THAT(format->channels, Eq(2));
+    EXPECT_FALSE(audio::isNative(*format));
+}
+
+TEST(AudioFormatTest, RawWithUnsupportedParameters)
+{
+    EXPECT_FALSE(audio::parseContentType("audio/raw; bits=8"));
+    EXPECT_FALSE(audio::parseContentType("audio/raw; endian=big"));
+    EXPECT_FALSE(audio::parseContentType("audio/raw; encoding=floating-point"));
+    EXPECT_FALSE(audio::parseContentType("audio/raw; rate=1000"));
+    EXPECT_FALSE(audio::parseContentType("audio/raw; rate=abc"));
+    EXPECT_FALSE(audio::parseContentType("audio/raw; channels=0"));
+}
+
+TEST(AudioFormatTest, Containers)
+{
+    EXPECT_THAT(audio::parseContentType("audio/wav")->codec, Eq(audio::Codec::Wav));
+    EXPECT_THAT(audio::parseContentType("Audio/X-WAV")->codec, Eq(audio::Codec::Wav));
+    EXPECT_THAT(audio::parseContentType("audio/flac")->codec, Eq(audio::Codec::Flac));
+    EXPECT_THAT(audio::parseContentType("audio/ogg; codecs=opus")->codec, Eq(audio::Codec::Opus));
+    EXPECT_THAT(audio::parseContentType("audio/ogg; codecs=\"opus\"")->codec,
+                Eq(audio::Codec::Opus));
+    EXPECT_THAT(audio::parseContentType("audio/opus")->codec, Eq(audio::Codec::Opus));
+}
+
+TEST(AudioFormatTest, Unsupported)
+{
+    EXPECT_FALSE(audio::parseContentType("audio/mpeg"));
+    EXPECT_FALSE(audio::parseContentType("audio/ogg; codecs=vorbis"));
+    EXPECT_FALSE(audio::parseContentType("text/plain"));
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "audio/PolyphaseResampler.hpp"
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace jar;
+using namespace testing;
+
+namespace {
+
+std::vector<float>
+sine(double frequency, std::uint32_t sampleRate, std::size_t count)
+{
+    std::vector<float> samples(count);
+    for (std::size_t n = 0; n < count; ++n) {
+        samples[n] = static_cast<float>(
+            0.5 * std::sin(2.0 * std::numbers::pi * frequency * static_cast<double>(n) / sampleRate));
+    }
+    return samples;
+}
+
+double
+rms(std::span<const float> samples)
+{
+    double sum{};
+    for (const float sample : samples) {
+        sum += static_cast<double>(sample) * sample;
+    }
+    return std::sqrt(sum / static_cast<double>(samples.size()));
+}
+
+} // namespace
+
+TEST(AudioPolyphaseResamplerTest, Factors)
+{
+    audio::PolyphaseResampler r1{48000, 16000};
+    EXPECT_THAT(r1.upFactor(), Eq(1));
+    EXPECT_THAT(r1.downFactor(), Eq(3));
+
+    audio::PolyphaseResampler r2{44100, 16000};
+    EXPECT_THAT(r2.upFactor(), Eq(160));
+    EXPECT_THAT(r2.downFactor(), Eq(441));
+    EXPECT_THAT(r2.taps() % 8, Eq(0));
+}
+
+TEST(AudioPolyphaseResamplerTest, OutputSize)
+{
+    static const std::uint32_t kInputRate{44100};
+    audio::PolyphaseResampler resampler{kInputRate, 16000};
+
+    /* Feed one second of audio in small blocks */
+    const auto input = sine(440.0, kInputRate, kInputRate);
+    std::vector<float> output;
+    for (std::size_t offset = 0; offset < input.size(); offset += 441) {
+        resampler.process(std::span{input}.subspan(offset, 441), output);
+    }
+    EXPECT_THAT(output.size(), AllOf(Ge(15990), Le(16000)));
+}
+
+TEST(AudioPolyphaseResamplerTest, PassBand)
+{
+    static const std::uint32_t kInputRate{48000};
+    audio::PolyphaseResampler resampler{kInputRate, 16000};
+
+    const auto input = sine(1000.0, kInputRate, kInputRate);
+    std::vector<float> output;
+    resampler.process(input, output);
+    resampler.flush(output);
+
+    /* Skip filter transient at the beginning and at the end */
+    const auto steady = std::span{output}.subspan(1000, output.size() - 2000);
+    EXPECT_THAT(rms(steady), DoubleNear(0.5 / std::numbers::sqrt2, 0.01));
+}
+
+TEST(AudioPolyphaseResamplerTest, StopBand)
+{
+    static const std::uint32_t kInputRate{48000};
+    audio::PolyphaseResampler resampler{kInputRate, 16000};
+
+    /* The tone above target Nyquist frequency must not alias into output */
+    const auto input = sine(12000.0, kInputRate, kInputRate);
+    std::vector<float> output;
+    resampler.process(input, output);
+
+    const auto steady = std::span{output}.subspan(1000, output.size() - 2000);
+    EXPECT_THAT(rms(steady), Lt(0.005));
+}
\ No newline at end of file
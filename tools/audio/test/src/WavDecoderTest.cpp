@@ -0,0 +1,157 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "audio/Decoder.hpp"
+
+#include <cstdint>
+#include <string>
+
+using namespace jar;
+using namespace testing;
+
+namespace {
+
+void
+put16(std::string& output, std::uint16_t value)
+{
+    output.push_back(static_cast<char>(value & 0xFF));
+    output.push_back(static_cast<char>(value >> 8));
+}
+
+void
+put32(std::string& output, std::uint32_t value)
+{
+    put16(output, static_cast<std::uint16_t>(value & 0xFFFF));
+    put16(output, static_cast<std::uint16_t>(value >> 16));
+}
+
+std::string
+makeWav(std::uint32_t sampleRate, std::uint16_t channels, const std::string& data)
+{
+    std::string output{"RIFF"};
+    put32(output, static_cast<std::uint32_t>(36 + 12 + data.size()));
+    output.append("WAVE");
+    output.append("fmt ");
+    put32(output, 16);
+    put16(output, 1);
+    put16(output, channels);
+    put32(output, sampleRate);
+    put32(output, sampleRate * channels * 2);
+    put16(output, static_cast<std::uint16_t>(channels * 2));
+    put16(output, 16);
+    /* Unknown chunk must be skipped */
+    output.append("LIST");
+    put32(output, 4);
+    output.append("INFO");
+    output.append("data");
+    put32(output, static_cast<std::uint32_t>(data.size()));
+    output.append(data);
+    return output;
+}
+
+std::string
+makeSamples(std::size_t frames, std::uint16_t channels, std::int16_t value)
+{
+    std::string output;
+    for (std::size_t n = 0; n < frames * channels; ++n) {
+        put16(output, static_cast<std::uint16_t>(value));
+    }
+    return output;
+}
+
+} // namespace
+
+TEST(AudioWavDecoderTest, NativeFormat)
+{
+    const auto samples = makeSamples(1600, 1, 1000);
+    const auto wav = makeWav(16000, 1, samples);
+
+    auto decoder = audio::Decoder::create({.codec = audio::Codec::Wav});
+    ASSERT_TRUE(decoder);
+
+    /* Feed data byte by byte to check incremental parsing */
+    std::string output;
+    for (const char byte : wav) {
+        ASSERT_FALSE(decoder->decode(std::string_view{&byte, 1}, output));
+    }
+    ASSERT_FALSE(decoder->finalize(output));
+    EXPECT_THAT(output, Eq(samples));
+}
+
+TEST(AudioWavDecoderTest, Downmix)
+{
+    const auto wav = makeWav(16000, 2, makeSamples(160, 2, 2000));
+
+    auto decoder = audio::Decoder::create({.codec = audio::Codec::Wav});
+    ASSERT_TRUE(decoder);
+
+    std::string output;
+    ASSERT_FALSE(decoder->decode(wav, output));
+    ASSERT_FALSE(decoder->finalize(output));
+    EXPECT_THAT(output, Eq(makeSamples(160, 1, 2000)));
+}
+
+TEST(AudioWavDecoderTest, Resample)
+{
+    const auto wav = makeWav(48000, 1, makeSamples(48000, 1, 0));
+
+    auto decoder = audio::Decoder::create({.codec = audio::Codec::Wav});
+    ASSERT_TRUE(decoder);
+
+    std::string output;
+    ASSERT_FALSE(decoder->decode(wav, output));
+    ASSERT_FALSE(decoder->finalize(output));
+    EXPECT_THAT(output.size() / 2, AllOf(Ge(16000), Le(16100)));
+}
+
+TEST(AudioWavDecoderTest, Streaming)
+{
+    const auto samples = makeSamples(1600, 1, 1000);
+    /* The placeholder is given instead of unknown size of data chunk */
+    auto wav = makeWav(16000, 1, {});
+    wav.replace(wav.size() - 4, 4, "\xFF\xFF\xFF\xFF");
+
+    auto decoder = audio::Decoder::create({.codec = audio::Codec::Wav});
+    ASSERT_TRUE(decoder);
+
+    std::string output;
+    ASSERT_FALSE(decoder->decode(wav, output));
+    ASSERT_FALSE(decoder->decode(samples, output));
+    ASSERT_FALSE(decoder->decode(samples, output));
+    ASSERT_FALSE(decoder->finalize(output));
+    EXPECT_THAT(output, Eq(samples + samples));
+}
+
+TEST(AudioWavDecoderTest, InvalidHeader)
+{
+    auto decoder = audio::Decoder::create({.codec = audio::Codec::Wav});
+    ASSERT_TRUE(decoder);
+
+    std::string output;
+    EXPECT_TRUE(decoder->decode("RIFX____WAVE", output));
+}
+
+TEST(AudioWavDecoderTest, RawPassthrough)
+{
+    auto decoder = audio::Decoder::create({});
+    ASSERT_TRUE(decoder);
+
+    std::string output;
+    ASSERT_FALSE(decoder->decode("abc", output));
+    ASSERT_FALSE(decoder->finalize(output));
+    EXPECT_THAT(output, Eq("abc"));
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "coro/BoundedChannel.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+using namespace jar;
+
+namespace {
+
+std::atomic<std::size_t> gAllocations{0};
+
+/* One second of speech in native format (16 kHz, 16 bit, mono) */
+constexpr std::size_t kSpeechSecond{16000 * 2};
+/* The size of speech chunk sent by client (20 ms) */
+constexpr std::size_t kClientChunk{640};
+/* The size of chunk gathered for the backend */
+constexpr std::size_t kBackendChunk{8192};
+
+using Channel = coro::BoundedChannel<char>;
+
+io::awaitable<void>
+produce(Channel& channel)
+{
+    const std::string chunk(kClientChunk, 'a');
+    for (std::size_t n = 0; n < kSpeechSecond; n += kClientChunk) {
+        co_await channel.send(io::buffer(chunk));
+    }
+    co_await channel.send(io::error::eof);
+    channel.close();
+}
+
+io::awaitable<void>
+consume(Channel& channel)
+{
+    static const std::chrono::milliseconds kDeadline{50};
+
+    /* Gathers the chunks the same way the speech recognition does */
+    std::string chunk(kBackendChunk, 0);
+    while (true) {
+        auto [ec, size] = co_await channel.recvSome(io::buffer(chunk));
+        if (not ec and size < kBackendChunk) {
+            const auto deadline = std::chrono::steady_clock::now() + kDeadline;
+            const auto result = co_await channel.recvUntil(
+                io::buffer(chunk.data() + size, kBackendChunk - size), deadline);
+            ec = result.error;
+        }
+        if (ec) {
+            break;
+        }
+    }
+}
+
+} // namespace
+
+void*
+operator new(std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size); ptr) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+/* Measures the allocations (mostly coroutine frames) per second of speech */
+static void
+BM_SpeechSecond(benchmark::State& state)
+{
+    std::size_t seconds{};
+    std::size_t allocations{};
+    for (auto _ : state) {
+        io::io_context context;
+        Channel channel{context.get_executor(), static_cast<std::size_t>(state.range(0))};
+        io::co_spawn(context, produce(channel), io::detached);
+        io::co_spawn(context, consume(channel), io::detached);
+        const std::size_t before = gAllocations.load();
+        context.run();
+        allocations += gAllocations.load() - before;
+        seconds++;
+    }
+    state.counters["allocs_per_speech_second"] = benchmark::Counter(
+        static_cast<double>(allocations) / static_cast<double>(seconds));
+}
+
+BENCHMARK(BM_SpeechSecond)->Arg(kSpeechSecond)->Arg(kClientChunk * 4);
\ No newline at end of file
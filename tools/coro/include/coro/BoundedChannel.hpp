@@ -18,8 +18,20 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include <algorithm>
+#include <memory_resource>
+#include <new>
+#include <tuple>
+
 namespace jar::coro {
 
+/**
+ * The channel with bounded capacity. The memory of channel is allocated on demand (up to
+ * the capacity) using given memory resource and released as the data is received.
+ *
+ * The channel is not thread-safe: it's expected to be used on the strand it's created with
+ * (the sender running elsewhere hands off the data to this strand).
+ */
 template<typename T>
 class BoundedChannel {
 public:
@@ -28,17 +40,44 @@ public:
         size_t size{};
     };
 
-    BoundedChannel(const io::any_io_executor& executor, size_t capacity)
-        : _sendCond{executor}
+    BoundedChannel(const io::any_io_executor& executor,
+                   size_t capacity,
+                   std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : _executor{executor}
+        , _sendCond{executor}
         , _recvCond{executor}
-        , _container{capacity}
+        , _container{capacity, Allocator{resource}}
+    {
+    }
+
+    /* Returns the executor the channel is expected to be used on */
+    [[nodiscard]] const io::any_io_executor&
+    executor() const
+    {
+        return _executor;
+    }
+
+    [[nodiscard]] size_t
+    capacity() const
+    {
+        return _container.capacity();
+    }
+
+    /* Returns the max number of elements held by channel at once */
+    [[nodiscard]] size_t
+    highWater() const
     {
+        return _highWater;
     }
 
+    /* Sends the status (e.g. eof) completing once the receiver has taken all the data */
     [[nodiscard]] io::awaitable<void>
     send(sys::error_code status)
     {
         co_await _recvCond.notify(status);
+        if (not _container.empty()) {
+            std::ignore = co_await _sendCond.wait([this]() { return _container.empty(); });
+        }
     }
 
     [[nodiscard]] bool
@@ -60,13 +99,32 @@ public:
 
         size_t needSend = buffer.size(), wasSent = 0;
         while (needSend > 0) {
-            const auto ec = co_await _sendCond.wait([this]() { return not _container.full(); });
-            if (ec) {
-                co_return Result{.error = ec, .size = wasSent};
+            if (mustWaitSend()) {
+                const auto ec
+                    = co_await _sendCond.wait([this]() { return not _container.full(); });
+                if (ec) {
+                    co_return Result{.error = ec, .size = wasSent};
+                }
             }
             const T* ptr = static_cast<const T*>(buffer.data());
-            const size_t size = std::min(_container.capacity() - _container.size(), needSend);
-            _container.insert(std::end(_container), ptr, ptr + size);
+            const size_t size = std::min(_container.reserve(), needSend);
+            try {
+                /* The memory is allocated before the container is modified */
+                _container.insert(std::end(_container), ptr, ptr + size);
+            } catch (const std::bad_alloc&) {
+                if (_container.empty()) {
+                    co_return Result{.error = sys::errc::make_error_code(
+                                         sys::errc::not_enough_memory),
+                                     .size = wasSent};
+                }
+                /* Wait for the receiver to release the memory */
+                const auto ec = co_await _sendCond.wait([this]() { return _container.empty(); });
+                if (ec) {
+                    co_return Result{.error = ec, .size = wasSent};
+                }
+                continue;
+            }
+            _highWater = std::max(_highWater, _container.size());
             buffer += size;
             needSend -= size, wasSent += size;
             assert(needSend <= buffer.size());
@@ -82,14 +140,16 @@ public:
 
         size_t needRecv = buffer.size(), wasRecv = 0;
         while (needRecv > 0) {
-            auto ec = co_await _recvCond.wait([this]() { return not _container.empty(); });
-            if (ec) {
-                co_return Result{.error = ec, .size = wasRecv};
+            if (mustWaitRecv()) {
+                auto ec = co_await _recvCond.wait([this]() { return not _container.empty(); });
+                if (ec) {
+                    co_return Result{.error = ec, .size = wasRecv};
+                }
             }
             T* ptr = static_cast<T*>(buffer.data());
             const size_t size = std::min(_container.size(), needRecv);
             std::copy(std::begin(_container), std::begin(_container) + size, ptr);
-            _container.erase_begin(size);
+            _container.erase(std::begin(_container), std::begin(_container) + size);
             buffer += size;
             needRecv -= size, wasRecv += size;
             _sendCond.tryNotify();
@@ -97,6 +157,47 @@ public:
         co_return Result{.error = sys::error_code{}, .size = wasRecv};
     }
 
+    /* Receives the data available at the moment waiting only for the first portion */
+    [[nodiscard]] io::awaitable<Result>
+    recvSome(io::mutable_buffer buffer)
+    {
+        assert(buffer.size() > 0);
+
+        if (mustWaitRecv()) {
+            auto ec = co_await _recvCond.wait([this]() { return not _container.empty(); });
+            if (ec) {
+                co_return Result{.error = ec, .size = 0};
+            }
+        }
+        co_return Result{.error = sys::error_code{}, .size = take(buffer)};
+    }
+
+    /* Receives the data until the buffer is full or the deadline is expired */
+    template<typename Clock, typename Duration>
+    [[nodiscard]] io::awaitable<Result>
+    recvUntil(io::mutable_buffer buffer, std::chrono::time_point<Clock, Duration> deadline)
+    {
+        assert(buffer.size() > 0);
+
+        size_t wasRecv = 0;
+        while (buffer.size() > 0) {
+            if (mustWaitRecv()) {
+                auto ec = co_await _recvCond.waitUntil(
+                    [this]() { return not _container.empty(); }, deadline);
+                if (ec == io::error::timed_out) {
+                    break;
+                }
+                if (ec) {
+                    co_return Result{.error = ec, .size = wasRecv};
+                }
+            }
+            const size_t size = take(buffer);
+            buffer += size;
+            wasRecv += size;
+        }
+        co_return Result{.error = sys::error_code{}, .size = wasRecv};
+    }
+
     void
     close()
     {
@@ -105,9 +206,38 @@ public:
     }
 
 private:
+    /* The wait (and its coroutine frame) is skipped while the channel is ready */
+    [[nodiscard]] bool
+    mustWaitSend() const
+    {
+        return (not _sendCond.opened() or _container.full());
+    }
+
+    [[nodiscard]] bool
+    mustWaitRecv() const
+    {
+        return (not _recvCond.opened() or _container.empty());
+    }
+
+    size_t
+    take(io::mutable_buffer buffer)
+    {
+        T* ptr = static_cast<T*>(buffer.data());
+        const size_t size = std::min(_container.size(), buffer.size());
+        std::copy(std::begin(_container), std::begin(_container) + size, ptr);
+        _container.erase(std::begin(_container), std::begin(_container) + size);
+        _sendCond.tryNotify();
+        return size;
+    }
+
+private:
+    using Allocator = std::pmr::polymorphic_allocator<T>;
+
+    io::any_io_executor _executor;
     Condition _sendCond;
     Condition _recvCond;
-    boost::circular_buffer<T> _container;
+    boost::circular_buffer_space_optimized<T, Allocator> _container;
+    size_t _highWater{};
 };
 
 } // namespace jar::coro
\ No newline at end of file
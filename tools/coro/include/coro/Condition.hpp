@@ -16,10 +16,19 @@
 
 #include "coro/Asio.hpp"
 
+#include <boost/asio/experimental/awaitable_operators.hpp>
+
+#include <chrono>
 #include <functional>
 
 namespace jar::coro {
 
+/**
+ * The condition is not thread-safe: it's expected to be used on a single strand.
+ *
+ * The status notification (e.g. eof) is kept and given back by every wait once the predicate
+ * isn't met, so it isn't lost by the wait given up upon deadline at the same time.
+ */
 class Condition {
 public:
     using Predicate = std::move_only_function<bool()>;
@@ -33,7 +42,10 @@ public:
     wait(Predicate predicate)
     {
         if (not _channel.is_open()) {
-            /* Channel is closed */
+            /* Channel is closed (the status given before is kept) */
+            if (_status) {
+                co_return _status;
+            }
             co_return sys::error_code{io::error::operation_aborted, sys::system_category()};
         }
 
@@ -43,6 +55,9 @@ public:
         }
 
         while (not predicate()) {
+            if (_status) {
+                co_return _status;
+            }
             auto [status, _] = co_await _channel.async_receive(io::as_tuple(io::use_awaitable));
             if (status) {
                 if (status.category() == ioe::error::get_channel_category()) {
@@ -56,16 +71,79 @@ public:
         co_return sys::error_code{};
     }
 
+    /**
+     * Waits for the predicate the same way as regular wait but not longer than given deadline.
+     * Return timed out error code upon the deadline expiry.
+     */
+    template<typename Clock, typename Duration>
+    io::awaitable<sys::error_code>
+    waitUntil(Predicate predicate, std::chrono::time_point<Clock, Duration> deadline)
+    {
+        using namespace boost::asio::experimental::awaitable_operators;
+
+        if (not _channel.is_open()) {
+            /* Channel is closed (the status given before is kept) */
+            if (_status) {
+                co_return _status;
+            }
+            co_return sys::error_code{io::error::operation_aborted, sys::system_category()};
+        }
+
+        io::basic_waitable_timer<Clock> timer{co_await io::this_coro::executor, deadline};
+        while (not predicate()) {
+            if (_status) {
+                co_return _status;
+            }
+            /* The wake up received at the deadline expiry is dropped (the predicate and the
+               status are checked by the next wait) */
+            auto result = co_await (_channel.async_receive(io::as_tuple(io::use_awaitable))
+                                    || timer.async_wait(io::as_tuple(io::use_awaitable)));
+            if (result.index() == 1) {
+                if (predicate()) {
+                    break;
+                }
+                if (_status) {
+                    co_return _status;
+                }
+                co_return sys::error_code{io::error::timed_out, sys::system_category()};
+            }
+            auto [status, _] = std::get<0>(result);
+            if (status) {
+                if (status.category() == ioe::error::get_channel_category()) {
+                    /* Channel is closed or cancelled while waiting */
+                    status.assign(io::error::operation_aborted, sys::system_category());
+                }
+                co_return status;
+            }
+        }
+
+        co_return sys::error_code{};
+    }
+
+    /* Wakes up the waiter (waits for it unless the status is given) */
     io::awaitable<void>
     notify(sys::error_code status = {})
     {
-        co_await _channel.async_send(status, unsigned{}, io::use_awaitable);
+        if (status) {
+            tryNotify(status);
+            co_return;
+        }
+        co_await _channel.async_send(sys::error_code{}, unsigned{}, io::use_awaitable);
     }
 
     void
     tryNotify(sys::error_code status = {})
     {
-        _channel.try_send(status, unsigned{});
+        if (status) {
+            _status = status;
+        }
+        _channel.try_send(sys::error_code{}, unsigned{});
+    }
+
+    [[nodiscard]] bool
+    opened() const
+    {
+        return _channel.is_open();
     }
 
     void
@@ -76,6 +154,7 @@ public:
 
 private:
     ioe::channel<void(sys::error_code, unsigned)> _channel;
+    sys::error_code _status;
 };
 
 } // namespace jar::coro
\ No newline at end of file
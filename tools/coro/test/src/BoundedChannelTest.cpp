@@ -116,4 +116,93 @@ TEST(BoundedChannelTest, Close)
         },
         io::detached);
     context.run();
+}
+
+TEST(BoundedChannelTest, RecvSome)
+{
+    static const size_t kChannelCapacity{3000};
+
+    io::io_context context;
+    TypedBoundedChannel channel{context.get_executor(), kChannelCapacity};
+    io::co_spawn(
+        context,
+        [&]() -> io::awaitable<void> {
+            std::string data(100, 'a');
+            co_await channel.send(io::buffer(data));
+        },
+        io::detached);
+    io::co_spawn(
+        context,
+        [&]() -> io::awaitable<void> {
+            std::string chunk(1000, 0);
+            const auto [ec, size] = co_await channel.recvSome(io::buffer(chunk));
+            EXPECT_FALSE(ec);
+            EXPECT_EQ(size, 100U);
+        },
+        io::detached);
+    context.run();
+}
+
+TEST(BoundedChannelTest, RecvUntilDeadline)
+{
+    static const size_t kChannelCapacity{3000};
+    static const auto kDelay{std::chrono::milliseconds{50}};
+
+    io::io_context context;
+    TypedBoundedChannel channel{context.get_executor(), kChannelCapacity};
+    io::co_spawn(
+        context,
+        [&]() -> io::awaitable<void> {
+            std::string data(100, 'a');
+            co_await channel.send(io::buffer(data));
+            co_await coro::asyncSleep(kDelay * 4);
+            co_await channel.send(io::buffer(data));
+            co_await channel.send(io::error::eof);
+            channel.close();
+        },
+        io::detached);
+    io::co_spawn(
+        context,
+        [&]() -> io::awaitable<void> {
+            std::string chunk(1000, 0);
+            /* The deadline expires before the second portion of data */
+            auto deadline = std::chrono::steady_clock::now() + kDelay;
+            auto result = co_await channel.recvUntil(io::buffer(chunk), deadline);
+            EXPECT_FALSE(result.error);
+            EXPECT_EQ(result.size, 100U);
+            /* The end of data comes before the deadline */
+            deadline = std::chrono::steady_clock::now() + kDelay * 10;
+            result = co_await channel.recvUntil(io::buffer(chunk), deadline);
+            EXPECT_EQ(result.error, io::error::eof);
+            EXPECT_EQ(result.size, 100U);
+        },
+        io::detached);
+    context.run();
+}
+
+TEST(BoundedChannelTest, GrowOnDemand)
+{
+    static const size_t kChannelCapacity{1'000'000};
+
+    std::pmr::monotonic_buffer_resource resource;
+    io::io_context context;
+    TypedBoundedChannel channel{context.get_executor(), kChannelCapacity, &resource};
+    EXPECT_EQ(channel.capacity(), kChannelCapacity);
+    io::co_spawn(
+        context,
+        [&]() -> io::awaitable<void> {
+            std::string data(100, 'a');
+            co_await channel.send(io::buffer(data));
+            co_await channel.send(io::buffer(data));
+            std::string chunk(1000, 0);
+            const auto [ec, size] = co_await channel.recvSome(io::buffer(chunk));
+            EXPECT_FALSE(ec);
+            EXPECT_EQ(size, 200U);
+            co_await channel.send(io::buffer(data));
+        },
+        io::detached);
+    context.run();
+
+    /* Only the memory needed for the data held at once is allocated */
+    EXPECT_EQ(channel.highWater(), 200U);
 }
\ No newline at end of file
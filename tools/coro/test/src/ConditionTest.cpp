@@ -86,3 +86,25 @@ TEST(ConditionTest, AutoCancelling)
         io::detached);
     context.run();
 }
+
+TEST(ConditionTest, KeepStatus)
+{
+    io::io_context context;
+    coro::Condition condition{context.get_executor()};
+    io::co_spawn(
+        context,
+        [&]() -> io::awaitable<void> {
+            /* The status given without waiter isn't lost by the wait upon deadline */
+            condition.tryNotify(io::error::eof);
+            const auto deadline = std::chrono::steady_clock::now();
+            EXPECT_EQ(co_await condition.waitUntil([]() { return false; }, deadline),
+                      io::error::eof);
+            EXPECT_EQ(co_await condition.wait([]() { return false; }), io::error::eof);
+            /* The met predicate goes first */
+            EXPECT_EQ(co_await condition.wait([]() { return true; }), sys::error_code{});
+            condition.close();
+            EXPECT_EQ(co_await condition.wait([]() { return false; }), io::error::eof);
+        },
+        io::detached);
+    context.run();
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "wit/IntentParser.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace jar;
+
+namespace {
+
+std::atomic<std::size_t> gAllocations{0};
+
+const std::string_view kMessageResult{R"({
+  "entities": {
+    "wit$datetime:datetime": [
+      {
+        "body": "tomorrow at 1 PM",
+        "confidence": 1,
+        "end": 40,
+        "entities": {},
+        "grain": "hour",
+        "id": "748915483355230",
+        "name": "wit$datetime",
+        "role": "datetime",
+        "start": 24,
+        "type": "value",
+        "value": "2023-04-22T13:00:00.000+03:00",
+        "values": [
+          {
+            "grain": "hour",
+            "type": "value",
+            "value": "2023-04-22T13:00:00.000+03:00"
+          }
+        ]
+      }
+    ]
+  },
+  "intents": [
+    {
+      "confidence": 0.9977334964561971,
+      "id": "981192742889976",
+      "name": "get_air_quality_status"
+    }
+  ],
+  "text": "what is air quality for tomorrow at 1 PM",
+  "traits": {}
+})"};
+
+} // namespace
+
+void*
+operator new(std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size); ptr) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+/* Measures the allocations per parsing of message recognition result */
+static void
+BM_ParseMessageResult(benchmark::State& state)
+{
+    std::size_t parses{};
+    const std::size_t allocations = gAllocations.load();
+    for (auto _ : state) {
+        auto result = wit::IntentParser::parseMessageResult(kMessageResult);
+        benchmark::DoNotOptimize(result);
+        parses++;
+    }
+    state.counters["allocs_per_parse"] = benchmark::Counter(
+        static_cast<double>(gAllocations.load() - allocations) / static_cast<double>(parses));
+}
+
+BENCHMARK(BM_ParseMessageResult);
\ No newline at end of file
@@ -0,0 +1,55 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "common/Recognition.hpp"
+#include "wit/Balancer.hpp"
+
+#include <functional>
+#include <memory>
+
+namespace jar::wit {
+
+/**
+ * The recognition running the recognition of endpoint chosen by the balancer and reporting
+ * the outcome to the balancer. The endpoint is acquired once the recognition is run (the one
+ * created and never run holds no endpoint). The latency of streaming recognition (e.g. speech)
+ * depends on the client, so it might be ignored (not sampled by the balancer).
+ */
+class BalancedRecognition final : public Recognition {
+public:
+    using Ptr = std::shared_ptr<BalancedRecognition>;
+    using Factory = std::function<std::shared_ptr<Recognition>(const Remote& remote)>;
+
+    enum class Latency { Checked, Ignored };
+
+    static Ptr
+    create(std::shared_ptr<Balancer> balancer,
+           Factory factory,
+           Latency latency = Latency::Checked);
+
+    io::awaitable<RecognitionResult>
+    run() final;
+
+private:
+    BalancedRecognition(std::shared_ptr<Balancer> balancer, Factory factory, Latency latency);
+
+private:
+    std::shared_ptr<Balancer> _balancer;
+    Factory _factory;
+    Latency _latency;
+};
+
+} // namespace jar::wit
\ No newline at end of file
@@ -0,0 +1,105 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace jar {
+class Counter;
+class Gauge;
+class Histogram;
+} // namespace jar
+
+namespace jar::wit {
+
+/**
+ * The backend endpoint (wit.ai app with its own token).
+ */
+struct Remote {
+    std::string host;
+    std::string port;
+    std::string auth;
+};
+
+/**
+ * The balancer of recognitions across backend endpoints.
+ *
+ * The endpoint with least outstanding requests is chosen (the tie is resolved by the lowest
+ * EWMA response latency). The endpoint is ejected for a while upon being throttled (429)
+ * or failing several times in a row.
+ */
+class Balancer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Outcome { Success, Throttled, Failed, Aborted };
+
+    struct Options {
+        /* The duration of endpoint ejection */
+        std::chrono::milliseconds ejectDuration{30000};
+        /* The number of consecutive failures to eject endpoint */
+        std::size_t maxFailures{3};
+    };
+
+    explicit Balancer(std::vector<Remote> remotes);
+
+    Balancer(std::vector<Remote> remotes, Options options);
+
+    ~Balancer();
+
+    [[nodiscard]] std::size_t
+    size() const;
+
+    [[nodiscard]] const Remote&
+    remote(std::size_t index) const;
+
+    /* Chooses the endpoint for the next request */
+    [[nodiscard]] std::size_t
+    acquire(Clock::time_point now = Clock::now());
+
+    /* Accounts the outcome of request to given endpoint (unknown latency isn't sampled) */
+    void
+    release(std::size_t index,
+            Outcome outcome,
+            std::optional<Clock::duration> latency,
+            Clock::time_point now = Clock::now());
+
+    [[nodiscard]] std::size_t
+    outstanding(std::size_t index) const;
+
+    [[nodiscard]] std::optional<double>
+    latency(std::size_t index) const;
+
+    [[nodiscard]] bool
+    ejected(std::size_t index, Clock::time_point now = Clock::now()) const;
+
+private:
+    struct Endpoint;
+
+    [[nodiscard]] bool
+    isEjected(const Endpoint& endpoint, Clock::time_point now) const;
+
+private:
+    Options _options;
+    mutable std::mutex _guard;
+    std::vector<Endpoint> _endpoints;
+};
+
+} // namespace jar::wit
\ No newline at end of file
@@ -0,0 +1,94 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace jar::wit {
+
+/**
+ * The circuit breaker of backend requests.
+ *
+ * The breaker opens when the rate of failed (or too slow) requests within the recent window
+ * exceeds the threshold. Being open, the breaker rejects requests until the open duration
+ * expires and then becomes half-open asking to probe the backend. Depending on the probe
+ * result the breaker is either closed or opened again.
+ */
+class CircuitBreaker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class State { Closed, Open, HalfOpen };
+
+    enum class Decision { Allow, Reject, Probe };
+
+    struct Options {
+        /* The fraction of failed requests to open the breaker */
+        double failureRate{0.5};
+        /* The min number of requests within window to estimate failure rate */
+        std::size_t minRequests{10};
+        /* The number of recent requests to estimate failure rate */
+        std::size_t windowSize{20};
+        /* The duration of request considered as failure */
+        std::chrono::milliseconds slowDuration{5000};
+        /* The duration of open state before probing */
+        std::chrono::milliseconds openDuration{10000};
+    };
+
+    CircuitBreaker();
+
+    explicit CircuitBreaker(Options options);
+
+    [[nodiscard]] const Options&
+    options() const;
+
+    [[nodiscard]] State
+    state() const;
+
+    /* Decides whether the request is allowed */
+    [[nodiscard]] Decision
+    acquire(Clock::time_point now = Clock::now());
+
+    /* Records succeeded request (unknown latency isn't classified as slow) */
+    void
+    onSuccess(std::optional<Clock::duration> latency, Clock::time_point now = Clock::now());
+
+    void
+    onFailure(Clock::time_point now = Clock::now());
+
+    void
+    onProbe(bool succeeded, Clock::time_point now = Clock::now());
+
+private:
+    void
+    record(bool failed, Clock::time_point now);
+
+    void
+    setState(State state, Clock::time_point now);
+
+private:
+    Options _options;
+    mutable std::mutex _guard;
+    State _state{State::Closed};
+    Clock::time_point _openedAt;
+    std::deque<bool> _outcomes;
+    std::size_t _failures{};
+};
+
+} // namespace jar::wit
\ No newline at end of file
@@ -0,0 +1,67 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+namespace jar::wit {
+
+/**
+ * The policy of coalescing incoming audio data into upstream chunks.
+ *
+ * The chunk is flushed when it reaches the target size or the max delay is expired,
+ * whichever comes first. The target size follows the incoming data rate (estimated by
+ * exponentially weighted moving average) so that chunk holds about max delay worth of data.
+ */
+class CoalescingPolicy {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::size_t minChunkSize{512};
+        /* Chunk with framing fits into single TLS record (16Kb) */
+        std::size_t maxChunkSize{16 * 1024 - 64};
+        std::chrono::milliseconds maxDelay{100};
+    };
+
+    CoalescingPolicy();
+
+    explicit CoalescingPolicy(Options options);
+
+    [[nodiscard]] const Options&
+    options() const;
+
+    [[nodiscard]] std::size_t
+    targetSize() const;
+
+    [[nodiscard]] Clock::time_point
+    deadline(Clock::time_point started) const;
+
+    /* Updates the incoming rate estimation by flushed chunk */
+    void
+    update(std::size_t size, Clock::time_point flushed);
+
+    [[nodiscard]] std::optional<double>
+    rate() const;
+
+private:
+    Options _options;
+    std::optional<Clock::time_point> _lastFlushed;
+    std::optional<double> _rate;
+};
+
+} // namespace jar::wit
\ No newline at end of file
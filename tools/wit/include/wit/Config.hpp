@@ -15,6 +15,10 @@
 #pragma once
 
 #include "common/ConfigLoader.hpp"
+#include "wit/Balancer.hpp"
+#include "wit/CircuitBreaker.hpp"
+#include "wit/CoalescingPolicy.hpp"
+#include "wit/HedgingPolicy.hpp"
 
 namespace jar::wit {
 
@@ -22,6 +26,10 @@ class Config : public ConfigLoader {
 public:
     Config() = default;
 
+    /* Returns all backend endpoints (the first one is also given by remote* methods) */
+    [[nodiscard]] const std::vector<Remote>&
+    remotes() const;
+
     [[nodiscard]] const std::string&
     remoteHost() const;
 
@@ -31,14 +39,31 @@ public:
     [[nodiscard]] const std::string&
     remoteAuth() const;
 
+    [[nodiscard]] const CoalescingPolicy::Options&
+    coalescing() const;
+
+    [[nodiscard]] const HedgingPolicy::Options&
+    hedging() const;
+
+    [[nodiscard]] const Balancer::Options&
+    balancer() const;
+
+    [[nodiscard]] const CircuitBreaker::Options&
+    breaker() const;
+
 private:
     bool
     doParse(const libconfig::Config& config) final;
 
 private:
+    std::vector<Remote> _remotes;
     std::string _remoteHost;
     std::string _remotePort;
     std::string _remoteAuth;
+    CoalescingPolicy::Options _coalescing;
+    HedgingPolicy::Options _hedging;
+    Balancer::Options _balancer;
+    CircuitBreaker::Options _breaker;
 };
 
 } // namespace jar::wit
\ No newline at end of file
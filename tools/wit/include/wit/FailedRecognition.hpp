@@ -0,0 +1,49 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "common/Recognition.hpp"
+#include "coro/BoundedChannel.hpp"
+
+#include <memory>
+
+namespace jar::wit {
+
+/**
+ * The recognition failing immediately (used when backend is unavailable).
+ */
+class FailedRecognition final : public Recognition {
+public:
+    using Ptr = std::shared_ptr<FailedRecognition>;
+    using Channel = coro::BoundedChannel<char>;
+
+    static Ptr
+    create(sys::error_code error);
+
+    static Ptr
+    create(std::shared_ptr<Channel> channel, sys::error_code error);
+
+    io::awaitable<RecognitionResult>
+    run() final;
+
+private:
+    FailedRecognition(std::shared_ptr<Channel> channel, sys::error_code error);
+
+private:
+    std::shared_ptr<Channel> _channel;
+    sys::error_code _error;
+};
+
+} // namespace jar::wit
\ No newline at end of file
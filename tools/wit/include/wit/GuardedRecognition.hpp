@@ -0,0 +1,55 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "common/Recognition.hpp"
+#include "wit/CircuitBreaker.hpp"
+
+#include <memory>
+
+namespace jar::wit {
+
+/**
+ * The recognition reporting the outcome of wrapped recognition to the circuit breaker. The
+ * latency of streaming recognition (e.g. speech) depends on the client, so it might be ignored
+ * (the recognition isn't taken as slow one).
+ */
+class GuardedRecognition final : public Recognition,
+                                 public std::enable_shared_from_this<GuardedRecognition> {
+public:
+    using Ptr = std::shared_ptr<GuardedRecognition>;
+
+    enum class Latency { Checked, Ignored };
+
+    static Ptr
+    create(std::shared_ptr<Recognition> recognition,
+           std::shared_ptr<CircuitBreaker> breaker,
+           Latency latency = Latency::Checked);
+
+    io::awaitable<RecognitionResult>
+    run() final;
+
+private:
+    GuardedRecognition(std::shared_ptr<Recognition> recognition,
+                       std::shared_ptr<CircuitBreaker> breaker,
+                       Latency latency);
+
+private:
+    std::shared_ptr<Recognition> _recognition;
+    std::shared_ptr<CircuitBreaker> _breaker;
+    Latency _latency;
+};
+
+} // namespace jar::wit
\ No newline at end of file
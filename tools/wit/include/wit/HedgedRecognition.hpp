@@ -0,0 +1,64 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "common/Recognition.hpp"
+#include "wit/HedgingPolicy.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace jar::wit {
+
+/**
+ * The message recognition sending the duplicate (hedge) request using separate connection
+ * if primary request doesn't respond within hedging delay. The first response wins and
+ * the request of loser is cancelled.
+ */
+class HedgedRecognition final : public Recognition,
+                                public std::enable_shared_from_this<HedgedRecognition> {
+public:
+    using Ptr = std::shared_ptr<HedgedRecognition>;
+    using Factory = std::function<std::shared_ptr<Recognition>(std::string message)>;
+
+    static Ptr
+    create(std::string message,
+           std::shared_ptr<HedgingPolicy> policy,
+           Factory factory);
+
+    io::awaitable<RecognitionResult>
+    run() final;
+
+private:
+    HedgedRecognition(std::string message,
+                      std::shared_ptr<HedgingPolicy> policy,
+                      Factory factory);
+
+    io::awaitable<RecognitionResult>
+    runPrimary();
+
+    io::awaitable<RecognitionResult>
+    runHedge();
+
+private:
+    std::string _message;
+    std::shared_ptr<HedgingPolicy> _policy;
+    Factory _factory;
+    std::shared_ptr<Recognition> _primary;
+    std::shared_ptr<Recognition> _hedge;
+};
+
+} // namespace jar::wit
\ No newline at end of file
@@ -0,0 +1,81 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+
+namespace jar::wit {
+
+/**
+ * The policy of hedging backend requests.
+ *
+ * The duplicate (hedge) request is sent when no response arrives within the delay. The delay
+ * is either fixed or follows the p95 estimation of recent response latencies. The number of
+ * hedge requests is limited by budget (the fraction of extra requests to primary ones).
+ */
+class HedgingPolicy {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        /* The fixed hedging delay (zero means adaptive p95 delay) */
+        std::chrono::milliseconds delay{0};
+        /* The fraction of extra requests (zero means hedging is disabled) */
+        double budget{0.05};
+    };
+
+    /* The number of samples to estimate the response latency percentile */
+    static constexpr std::size_t kWindowSize{128};
+
+    HedgingPolicy();
+
+    explicit HedgingPolicy(Options options);
+
+    [[nodiscard]] const Options&
+    options() const;
+
+    [[nodiscard]] bool
+    enabled() const;
+
+    /* Returns the hedging delay to use by the next request */
+    [[nodiscard]] std::chrono::milliseconds
+    delay() const;
+
+    /* Accounts the primary request within the budget */
+    void
+    onRequest();
+
+    /* Tries to acquire the budget to send the hedge request */
+    [[nodiscard]] bool
+    tryHedge();
+
+    /* Updates the latency estimation by given response latency */
+    void
+    update(Clock::duration latency);
+
+private:
+    Options _options;
+    mutable std::mutex _guard;
+    double _tokens{};
+    std::array<double, kWindowSize> _samples{};
+    std::size_t _count{};
+    std::size_t _index{};
+};
+
+} // namespace jar::wit
\ No newline at end of file
@@ -14,10 +14,10 @@
 
 #pragma once
 
-#include "coro/BoundedChannel.hpp"
 #include "wit/RemoteRecognition.hpp"
 
 #include <memory>
+#include <string>
 
 namespace jar::wit {
 
@@ -25,7 +25,6 @@ class MessageRecognition final : public RemoteRecognition,
                                  public std::enable_shared_from_this<MessageRecognition> {
 public:
     using Ptr = std::shared_ptr<MessageRecognition>;
-    using Channel = coro::BoundedChannel<char>;
 
     static Ptr
     create(io::any_io_executor executor,
@@ -33,7 +32,7 @@ public:
            std::string host,
            std::string port,
            std::string auth,
-           std::shared_ptr<Channel> channel);
+           std::string message);
 
 private:
     explicit MessageRecognition(io::any_io_executor executor,
@@ -41,13 +40,13 @@ private:
                                 std::string host,
                                 std::string port,
                                 std::string auth,
-                                std::shared_ptr<Channel> channel);
+                                std::string message);
 
     io::awaitable<Utterances>
     process() final;
 
 private:
-    std::shared_ptr<Channel> _channel;
+    std::string _message;
 };
 
 } // namespace jar::wit
\ No newline at end of file
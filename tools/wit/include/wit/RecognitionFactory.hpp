@@ -15,15 +15,21 @@
 #pragma once
 
 #include "common/IRecognitionFactory.hpp"
+#include "wit/Balancer.hpp"
+#include "wit/CircuitBreaker.hpp"
+#include "wit/CoalescingPolicy.hpp"
+#include "wit/HedgingPolicy.hpp"
 
 #include <jarvisto/network/Asio.hpp>
 #include <jarvisto/network/SecureContext.hpp>
 
-#include <optional>
+#include <memory>
 #include <string>
 
 namespace jar::wit {
 
+class Config;
+
 class RecognitionFactory final : public IRecognitionFactory {
 public:
     RecognitionFactory();
@@ -32,7 +38,7 @@ public:
     canRecognizeMessage() const final;
 
     [[nodiscard]] std::shared_ptr<Recognition>
-    message(io::any_io_executor executor, std::shared_ptr<DataChannel> channel) final;
+    message(io::any_io_executor executor, std::string message) final;
 
     [[nodiscard]] bool
     canRecognizeSpeech() const final;
@@ -41,9 +47,22 @@ public:
     speech(io::any_io_executor executor, std::shared_ptr<DataChannel> channel) final;
 
 private:
-    std::optional<std::string> _remoteHost;
-    std::optional<std::string> _remotePort;
-    std::optional<std::string> _remoteAuth;
+    explicit RecognitionFactory(const Config& config);
+
+    [[nodiscard]] bool
+    admit(const io::any_io_executor& executor);
+
+    void
+    probe(const io::any_io_executor& executor);
+
+    [[nodiscard]] std::shared_ptr<Recognition>
+    balancedMessage(const io::any_io_executor& executor, std::string message);
+
+private:
+    std::shared_ptr<Balancer> _balancer;
+    CoalescingPolicy::Options _coalescing;
+    std::shared_ptr<HedgingPolicy> _hedging;
+    std::shared_ptr<CircuitBreaker> _breaker;
     SecureContext _context;
 };
 
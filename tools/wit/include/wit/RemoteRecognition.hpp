@@ -47,6 +47,10 @@ protected:
     [[nodiscard]] const std::string&
     remoteAuth() const;
 
+    /* Throws recognition error if given response status tells about backend failure */
+    static void
+    verifyStatus(http::status status);
+
     virtual io::awaitable<void>
     connect();
 
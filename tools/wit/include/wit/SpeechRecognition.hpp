@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "wit/CoalescingPolicy.hpp"
 #include "wit/RemoteRecognition.hpp"
 
 #include "coro/BoundedChannel.hpp"
@@ -35,7 +36,8 @@ public:
            std::string host,
            std::string port,
            std::string auth,
-           std::shared_ptr<Channel> channel);
+           std::shared_ptr<Channel> channel,
+           CoalescingPolicy::Options options = {});
 
 private:
     explicit SpeechRecognition(io::any_io_executor executor,
@@ -43,13 +45,18 @@ private:
                                std::string host,
                                std::string port,
                                std::string auth,
-                               std::shared_ptr<Channel> channel);
+                               std::shared_ptr<Channel> channel,
+                               CoalescingPolicy::Options options);
 
     io::awaitable<Utterances>
     process() final;
 
+    io::awaitable<Channel::Result>
+    coalesce(std::string& chunk);
+
 private:
     std::shared_ptr<Channel> _channel;
+    CoalescingPolicy _policy;
 };
 
 } // namespace jar::wit
\ No newline at end of file
@@ -0,0 +1,121 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "wit/BalancedRecognition.hpp"
+
+#include "common/Errors.hpp"
+
+#include <jarvisto/network/Http.hpp>
+
+#include <boost/assert.hpp>
+
+namespace jar::wit {
+
+namespace {
+
+[[nodiscard]] Balancer::Outcome
+toOutcome(const sys::error_code& ec)
+{
+    if (ec == RecognitionErrc::Throttled) {
+        return Balancer::Outcome::Throttled;
+    }
+    if (isRetryable(ec) or ec == beast::error::timeout) {
+        return Balancer::Outcome::Failed;
+    }
+    return Balancer::Outcome::Aborted;
+}
+
+/* The endpoint acquired for the run (it's released upon any way the run is finished) */
+class Lease {
+public:
+    Lease(Balancer& balancer, bool measured)
+        : _balancer{balancer}
+        , _index{balancer.acquire()}
+        , _started{Balancer::Clock::now()}
+        , _measured{measured}
+    {
+    }
+
+    ~Lease()
+    {
+        _balancer.release(_index,
+                          _outcome,
+                          _measured ? std::make_optional(Balancer::Clock::now() - _started)
+                                    : std::nullopt);
+    }
+
+    Lease(const Lease&) = delete;
+    Lease&
+    operator=(const Lease&) = delete;
+
+    [[nodiscard]] std::size_t
+    index() const
+    {
+        return _index;
+    }
+
+    void
+    complete(Balancer::Outcome outcome)
+    {
+        _outcome = outcome;
+    }
+
+private:
+    Balancer& _balancer;
+    std::size_t _index;
+    Balancer::Clock::time_point _started;
+    bool _measured;
+    Balancer::Outcome _outcome{Balancer::Outcome::Aborted};
+};
+
+} // namespace
+
+BalancedRecognition::Ptr
+BalancedRecognition::create(std::shared_ptr<Balancer> balancer,
+                            Factory factory,
+                            Latency latency /*= Latency::Checked*/)
+{
+    return Ptr(new BalancedRecognition(std::move(balancer), std::move(factory), latency));
+}
+
+BalancedRecognition::BalancedRecognition(std::shared_ptr<Balancer> balancer,
+                                         Factory factory,
+                                         Latency latency)
+    : _balancer{std::move(balancer)}
+    , _factory{std::move(factory)}
+    , _latency{latency}
+{
+    BOOST_ASSERT(_balancer);
+    BOOST_ASSERT(_factory);
+}
+
+io::awaitable<RecognitionResult>
+BalancedRecognition::run()
+{
+    Lease lease{*_balancer, _latency == Latency::Checked};
+    auto recognition = _factory(_balancer->remote(lease.index()));
+    BOOST_ASSERT(recognition);
+    onCancel().assign([recognition](auto) { recognition->cancel(); });
+
+    try {
+        auto result = co_await recognition->run();
+        lease.complete(Balancer::Outcome::Success);
+        co_return std::move(result);
+    } catch (const sys::system_error& e) {
+        lease.complete(toOutcome(e.code()));
+        throw;
+    }
+}
+
+} // namespace jar::wit
\ No newline at end of file
@@ -0,0 +1,201 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "wit/Balancer.hpp"
+
+#include "common/Metrics.hpp"
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <boost/assert.hpp>
+
+#include <spdlog/fmt/fmt.h>
+
+namespace jar::wit {
+
+namespace {
+
+/* The weight of the latest latency sample */
+constexpr double kAlpha{0.3};
+
+} // namespace
+
+struct Balancer::Endpoint {
+    explicit Endpoint(Remote remote, std::size_t index)
+        : remote{std::move(remote)}
+        , requests{Metrics::instance().counter(fmt::format("wit.remote.{}.requests", index))}
+        , throttled{Metrics::instance().counter(fmt::format("wit.remote.{}.throttled", index))}
+        , errors{Metrics::instance().counter(fmt::format("wit.remote.{}.errors", index))}
+        , pending{Metrics::instance().gauge(fmt::format("wit.remote.{}.outstanding", index))}
+        , latencies{Metrics::instance().histogram(fmt::format("wit.remote.{}.latency_ms", index),
+                                                  {50, 100, 250, 500, 1000, 2500, 5000})}
+    {
+    }
+
+    Remote remote;
+    std::size_t outstanding{};
+    std::size_t failures{};
+    std::optional<double> latency;
+    std::optional<Clock::time_point> ejectedUntil;
+    Counter& requests;
+    Counter& throttled;
+    Counter& errors;
+    Gauge& pending;
+    Histogram& latencies;
+};
+
+Balancer::Balancer(std::vector<Remote> remotes)
+    : Balancer{std::move(remotes), Options{}}
+{
+}
+
+Balancer::Balancer(std::vector<Remote> remotes, Options options)
+    : _options{options}
+{
+    BOOST_ASSERT(not remotes.empty());
+    _endpoints.reserve(remotes.size());
+    for (std::size_t n = 0; n < remotes.size(); ++n) {
+        _endpoints.emplace_back(std::move(remotes[n]), n);
+    }
+}
+
+Balancer::~Balancer() = default;
+
+std::size_t
+Balancer::size() const
+{
+    return _endpoints.size();
+}
+
+const Remote&
+Balancer::remote(std::size_t index) const
+{
+    BOOST_ASSERT(index < _endpoints.size());
+    return _endpoints[index].remote;
+}
+
+std::size_t
+Balancer::acquire(Clock::time_point now)
+{
+    std::lock_guard lock{_guard};
+
+    std::optional<std::size_t> chosen;
+    for (std::size_t n = 0; n < _endpoints.size(); ++n) {
+        const auto& endpoint = _endpoints[n];
+        if (isEjected(endpoint, now)) {
+            continue;
+        }
+        if (not chosen) {
+            chosen = n;
+            continue;
+        }
+        const auto& best = _endpoints[*chosen];
+        if (endpoint.outstanding < best.outstanding
+            or (endpoint.outstanding == best.outstanding
+                and endpoint.latency.value_or(0.0) < best.latency.value_or(0.0))) {
+            chosen = n;
+        }
+    }
+
+    if (not chosen) {
+        /* All endpoints are ejected so choose the one to be back soonest */
+        chosen = 0;
+        for (std::size_t n = 1; n < _endpoints.size(); ++n) {
+            if (_endpoints[n].ejectedUntil < _endpoints[*chosen].ejectedUntil) {
+                chosen = n;
+            }
+        }
+    }
+
+    auto& endpoint = _endpoints[*chosen];
+    endpoint.outstanding++;
+    endpoint.requests.increment();
+    endpoint.pending.increment();
+    return *chosen;
+}
+
+void
+Balancer::release(std::size_t index,
+                  Outcome outcome,
+                  std::optional<Clock::duration> latency,
+                  Clock::time_point now)
+{
+    std::lock_guard lock{_guard};
+    BOOST_ASSERT(index < _endpoints.size());
+    auto& endpoint = _endpoints[index];
+    BOOST_ASSERT(endpoint.outstanding > 0);
+    endpoint.outstanding--;
+    endpoint.pending.decrement();
+
+    switch (outcome) {
+    case Outcome::Success: {
+        if (latency) {
+            const double value = std::chrono::duration<double, std::milli>(*latency).count();
+            endpoint.latency
+                = endpoint.latency ? (kAlpha * value + (1.0 - kAlpha) * *endpoint.latency) : value;
+            endpoint.latencies.observe(value);
+        }
+        endpoint.failures = 0;
+        endpoint.ejectedUntil.reset();
+        break;
+    }
+    case Outcome::Throttled:
+        LOGW("Eject throttled backend endpoint: index<{}>", index);
+        endpoint.throttled.increment();
+        endpoint.ejectedUntil = now + _options.ejectDuration;
+        break;
+    case Outcome::Failed:
+        endpoint.errors.increment();
+        if (++endpoint.failures >= _options.maxFailures) {
+            LOGW("Eject failed backend endpoint: index<{}>, failures<{}>", index, endpoint.failures);
+            endpoint.ejectedUntil = now + _options.ejectDuration;
+            endpoint.failures = 0;
+        }
+        break;
+    case Outcome::Aborted:
+        break;
+    }
+}
+
+std::size_t
+Balancer::outstanding(std::size_t index) const
+{
+    std::lock_guard lock{_guard};
+    BOOST_ASSERT(index < _endpoints.size());
+    return _endpoints[index].outstanding;
+}
+
+std::optional<double>
+Balancer::latency(std::size_t index) const
+{
+    std::lock_guard lock{_guard};
+    BOOST_ASSERT(index < _endpoints.size());
+    return _endpoints[index].latency;
+}
+
+bool
+Balancer::ejected(std::size_t index, Clock::time_point now) const
+{
+    std::lock_guard lock{_guard};
+    BOOST_ASSERT(index < _endpoints.size());
+    return isEjected(_endpoints[index], now);
+}
+
+bool
+Balancer::isEjected(const Endpoint& endpoint, Clock::time_point now) const
+{
+    return (endpoint.ejectedUntil and now < *endpoint.ejectedUntil);
+}
+
+} // namespace jar::wit
\ No newline at end of file
@@ -0,0 +1,161 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "wit/CircuitBreaker.hpp"
+
+#include "common/Metrics.hpp"
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <boost/assert.hpp>
+
+namespace jar::wit {
+
+namespace {
+
+struct BreakerMetrics {
+    Gauge& state{Metrics::instance().gauge("wit.breaker.state")};
+    Counter& opened{Metrics::instance().counter("wit.breaker.opened")};
+    Counter& rejected{Metrics::instance().counter("wit.breaker.rejected")};
+    Counter& probes{Metrics::instance().counter("wit.breaker.probes")};
+};
+
+BreakerMetrics&
+metrics()
+{
+    static BreakerMetrics instance;
+    return instance;
+}
+
+const char*
+toString(CircuitBreaker::State state)
+{
+    switch (state) {
+    case CircuitBreaker::State::Closed:
+        return "closed";
+    case CircuitBreaker::State::Open:
+        return "open";
+    case CircuitBreaker::State::HalfOpen:
+        return "half-open";
+    }
+    return "unknown";
+}
+
+} // namespace
+
+CircuitBreaker::CircuitBreaker()
+    : CircuitBreaker{Options{}}
+{
+}
+
+CircuitBreaker::CircuitBreaker(Options options)
+    : _options{options}
+{
+    BOOST_ASSERT(_options.failureRate > 0.0);
+    BOOST_ASSERT(_options.minRequests <= _options.windowSize);
+}
+
+const CircuitBreaker::Options&
+CircuitBreaker::options() const
+{
+    return _options;
+}
+
+CircuitBreaker::State
+CircuitBreaker::state() const
+{
+    std::lock_guard lock{_guard};
+    return _state;
+}
+
+CircuitBreaker::Decision
+CircuitBreaker::acquire(Clock::time_point now)
+{
+    std::lock_guard lock{_guard};
+    if (_state == State::Closed) {
+        return Decision::Allow;
+    }
+    if (_state == State::Open and now >= _openedAt + _options.openDuration) {
+        setState(State::HalfOpen, now);
+        metrics().probes.increment();
+        return Decision::Probe;
+    }
+    metrics().rejected.increment();
+    return Decision::Reject;
+}
+
+void
+CircuitBreaker::onSuccess(std::optional<Clock::duration> latency, Clock::time_point now)
+{
+    std::lock_guard lock{_guard};
+    record(latency and *latency >= _options.slowDuration, now);
+}
+
+void
+CircuitBreaker::onFailure(Clock::time_point now)
+{
+    std::lock_guard lock{_guard};
+    record(true, now);
+}
+
+void
+CircuitBreaker::onProbe(bool succeeded, Clock::time_point now)
+{
+    std::lock_guard lock{_guard};
+    if (_state == State::HalfOpen) {
+        setState(succeeded ? State::Closed : State::Open, now);
+    }
+}
+
+void
+CircuitBreaker::record(bool failed, Clock::time_point now)
+{
+    if (_state != State::Closed) {
+        /* The outcome of request started before opening */
+        return;
+    }
+
+    _outcomes.push_back(failed);
+    _failures += failed ? 1 : 0;
+    if (_outcomes.size() > _options.windowSize) {
+        _failures -= _outcomes.front() ? 1 : 0;
+        _outcomes.pop_front();
+    }
+
+    if (_outcomes.size() >= _options.minRequests) {
+        const double rate
+            = static_cast<double>(_failures) / static_cast<double>(_outcomes.size());
+        if (rate >= _options.failureRate) {
+            setState(State::Open, now);
+        }
+    }
+}
+
+void
+CircuitBreaker::setState(State state, Clock::time_point now)
+{
+    LOGI("Change circuit breaker state: <{}> => <{}>", toString(_state), toString(state));
+    _state = state;
+    if (_state == State::Open) {
+        _openedAt = now;
+        metrics().opened.increment();
+    }
+    if (_state == State::Closed) {
+        _outcomes.clear();
+        _failures = 0;
+    }
+    metrics().state.set(static_cast<std::int64_t>(_state));
+}
+
+} // namespace jar::wit
\ No newline at end of file
@@ -0,0 +1,84 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "wit/CoalescingPolicy.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+
+namespace jar::wit {
+
+namespace {
+
+/* The weight of the latest rate sample */
+constexpr double kAlpha{0.25};
+
+} // namespace
+
+CoalescingPolicy::CoalescingPolicy()
+    : CoalescingPolicy{Options{}}
+{
+}
+
+CoalescingPolicy::CoalescingPolicy(Options options)
+    : _options{options}
+{
+    BOOST_ASSERT(_options.minChunkSize > 0);
+    BOOST_ASSERT(_options.minChunkSize <= _options.maxChunkSize);
+}
+
+const CoalescingPolicy::Options&
+CoalescingPolicy::options() const
+{
+    return _options;
+}
+
+std::size_t
+CoalescingPolicy::targetSize() const
+{
+    if (not _rate) {
+        return _options.minChunkSize;
+    }
+    const double seconds = std::chrono::duration<double>(_options.maxDelay).count();
+    const auto size = static_cast<std::size_t>(*_rate * seconds);
+    return std::clamp(size, _options.minChunkSize, _options.maxChunkSize);
+}
+
+CoalescingPolicy::Clock::time_point
+CoalescingPolicy::deadline(Clock::time_point started) const
+{
+    return started + _options.maxDelay;
+}
+
+void
+CoalescingPolicy::update(std::size_t size, Clock::time_point flushed)
+{
+    if (_lastFlushed) {
+        const double seconds = std::chrono::duration<double>(flushed - *_lastFlushed).count();
+        if (seconds > 0.0) {
+            const double rate = static_cast<double>(size) / seconds;
+            _rate = _rate ? (kAlpha * rate + (1.0 - kAlpha) * *_rate) : rate;
+        }
+    }
+    _lastFlushed = flushed;
+}
+
+std::optional<double>
+CoalescingPolicy::rate() const
+{
+    return _rate;
+}
+
+} // namespace jar::wit
\ No newline at end of file
@@ -16,8 +16,40 @@
 
 #include <jarvisto/core/Logger.hpp>
 
+#include <algorithm>
+#include <optional>
+
 namespace jar::wit {
 
+namespace {
+
+std::optional<Remote>
+parseRemote(const libconfig::Setting& root)
+{
+    Remote remote;
+    if (not root.lookupValue("host", remote.host)) {
+        LOGW("Mandatory 'host' option value is absent");
+        return std::nullopt;
+    }
+    if (not root.lookupValue("port", remote.port)) {
+        LOGW("Mandatory 'port' option value is absent");
+        return std::nullopt;
+    }
+    if (not root.lookupValue("auth", remote.auth)) {
+        LOGW("Mandatory 'auth' option value is absent");
+        return std::nullopt;
+    }
+    return remote;
+}
+
+} // namespace
+
+const std::vector<Remote>&
+Config::remotes() const
+{
+    return _remotes;
+}
+
 const std::string&
 Config::remoteHost() const
 {
@@ -36,23 +68,102 @@ Config::remoteAuth() const
     return _remoteAuth;
 }
 
+const CoalescingPolicy::Options&
+Config::coalescing() const
+{
+    return _coalescing;
+}
+
+const HedgingPolicy::Options&
+Config::hedging() const
+{
+    return _hedging;
+}
+
+const CircuitBreaker::Options&
+Config::breaker() const
+{
+    return _breaker;
+}
+
+const Balancer::Options&
+Config::balancer() const
+{
+    return _balancer;
+}
+
 bool
 Config::doParse(const libconfig::Config& config)
 {
-    if (not config.lookupValue("wit.remote.host", _remoteHost)) {
-        LOGW("Mandatory 'host' option value is absent");
-        return false;
+    static const char* kRemoteKey{"wit.remote"};
+    if (config.exists(kRemoteKey)) {
+        auto remote = parseRemote(config.lookup(kRemoteKey));
+        if (not remote) {
+            return false;
+        }
+        _remotes.push_back(std::move(remote.value()));
     }
 
-    if (not config.lookupValue("wit.remote.port", _remotePort)) {
-        LOGW("Mandatory 'port' option value is absent");
-        return false;
+    static const char* kRemotesKey{"wit.remotes"};
+    if (config.exists(kRemotesKey)) {
+        const auto& root = config.lookup(kRemotesKey);
+        for (int i = 0; i < root.getLength(); ++i) {
+            if (auto remote = parseRemote(root[i]); remote) {
+                _remotes.push_back(std::move(remote.value()));
+            }
+        }
     }
 
-    if (not config.lookupValue("wit.remote.auth", _remoteAuth)) {
-        LOGW("Mandatory 'auth' option value is absent");
+    if (_remotes.empty()) {
+        LOGW("Mandatory 'remote' option value is absent");
         return false;
     }
+    _remoteHost = _remotes.front().host;
+    _remotePort = _remotes.front().port;
+    _remoteAuth = _remotes.front().auth;
+
+    unsigned int value{};
+    if (config.lookupValue("wit.speech.chunkMinSize", value) and value > 0) {
+        _coalescing.minChunkSize = value;
+    }
+    if (config.lookupValue("wit.speech.chunkMaxSize", value) and value > 0) {
+        _coalescing.maxChunkSize = value;
+    }
+    if (config.lookupValue("wit.speech.chunkMaxDelay", value)) {
+        _coalescing.maxDelay = std::chrono::milliseconds{value};
+    }
+    if (_coalescing.minChunkSize > _coalescing.maxChunkSize) {
+        LOGW("Invalid speech chunk size options: min<{}>, max<{}>",
+             _coalescing.minChunkSize,
+             _coalescing.maxChunkSize);
+        _coalescing = CoalescingPolicy::Options{};
+    }
+
+    if (config.lookupValue("wit.message.hedgingDelay", value)) {
+        _hedging.delay = std::chrono::milliseconds{value};
+    }
+    if (config.lookupValue("wit.message.hedgingBudget", value)) {
+        /* The budget is given in percents of extra requests */
+        _hedging.budget = static_cast<double>(std::min(value, 100U)) / 100.0;
+    }
+
+    if (config.lookupValue("wit.balancer.ejectDuration", value)) {
+        _balancer.ejectDuration = std::chrono::milliseconds{value};
+    }
+    if (config.lookupValue("wit.balancer.maxFailures", value) and value > 0) {
+        _balancer.maxFailures = value;
+    }
+
+    if (config.lookupValue("wit.breaker.failureRate", value) and value > 0) {
+        /* The failure rate is given in percents of failed requests */
+        _breaker.failureRate = static_cast<double>(std::min(value, 100U)) / 100.0;
+    }
+    if (config.lookupValue("wit.breaker.slowDuration", value) and value > 0) {
+        _breaker.slowDuration = std::chrono::milliseconds{value};
+    }
+    if (config.lookupValue("wit.breaker.openDuration", value)) {
+        _breaker.openDuration = std::chrono::milliseconds{value};
+    }
 
     return true;
 }
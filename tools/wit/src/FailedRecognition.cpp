@@ -0,0 +1,54 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "wit/FailedRecognition.hpp"
+
+#include <jarvisto/core/Logger.hpp>
+
+#include <boost/assert.hpp>
+
+namespace jar::wit {
+
+FailedRecognition::Ptr
+FailedRecognition::create(sys::error_code error)
+{
+    return Ptr(new FailedRecognition(nullptr, error));
+}
+
+FailedRecognition::Ptr
+FailedRecognition::create(std::shared_ptr<Channel> channel, sys::error_code error)
+{
+    return Ptr(new FailedRecognition(std::move(channel), error));
+}
+
+FailedRecognition::FailedRecognition(std::shared_ptr<Channel> channel, sys::error_code error)
+    : _channel{std::move(channel)}
+    , _error{error}
+{
+    BOOST_ASSERT(_error);
+}
+
+io::awaitable<RecognitionResult>
+FailedRecognition::run()
+{
+    LOGW("Recognition is failed fast: error<{}>", _error.message());
+    if (_channel) {
+        /* Unblock the sender of recognition data */
+        _channel->close();
+    }
+    throw sys::system_error{_error};
+    co_return RecognitionResult{};
+}
+
+} // namespace jar::wit
\ No newline at end of file
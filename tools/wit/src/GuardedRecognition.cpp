@@ -0,0 +1,80 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "wit/GuardedRecognition.hpp"
+
+#include "common/Errors.hpp"
+
+#include <jarvisto/network/Http.hpp>
+
+#include <boost/assert.hpp>
+
+namespace jar::wit {
+
+namespace {
+
+/* Whether the error tells about backend failure (throttling is handled by balancer) */
+[[nodiscard]] bool
+isFailure(const sys::error_code& ec)
+{
+    if (ec == RecognitionErrc::Throttled) {
+        return false;
+    }
+    return (isRetryable(ec) or ec == beast::error::timeout);
+}
+
+} // namespace
+
+GuardedRecognition::Ptr
+GuardedRecognition::create(std::shared_ptr<Recognition> recognition,
+                           std::shared_ptr<CircuitBreaker> breaker,
+                           Latency latency /*= Latency::Checked*/)
+{
+    return Ptr(new GuardedRecognition(std::move(recognition), std::move(breaker), latency));
+}
+
+GuardedRecognition::GuardedRecognition(std::shared_ptr<Recognition> recognition,
+                                       std::shared_ptr<CircuitBreaker> breaker,
+                                       Latency latency)
+    : _recognition{std::move(recognition)}
+    , _breaker{std::move(breaker)}
+    , _latency{latency}
+{
+    BOOST_ASSERT(_recognition);
+    BOOST_ASSERT(_breaker);
+}
+
+io::awaitable<RecognitionResult>
+GuardedRecognition::run()
+{
+    onCancel().assign([recognition = _recognition](auto) { recognition->cancel(); });
+
+    const auto started = CircuitBreaker::Clock::now();
+    try {
+        auto result = co_await _recognition->run();
+        if (_latency == Latency::Checked) {
+            _breaker->onSuccess(CircuitBreaker::Clock::now() - started);
+        } else {
+            _breaker->onSuccess(std::nullopt);
+        }
+        co_return std::move(result);
+    } catch (const sys::system_error& e) {
+        if (isFailure(e.code())) {
+            _breaker->onFailure();
+        }
+        throw;
+    }
+}
+
+} // namespace jar::wit
\ No newline at end of file
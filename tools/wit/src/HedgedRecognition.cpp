@@ -0,0 +1,123 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "wit/HedgedRecognition.hpp"
+
+#include "common/Logging.hpp"
+#include "common/Metrics.hpp"
+
+#include <boost/asio/experimental/awaitable_operators.hpp>
+#include <boost/assert.hpp>
+
+#include <variant>
+
+using namespace boost::asio::experimental::awaitable_operators;
+
+namespace jar::wit {
+
+namespace {
+
+struct HedgingMetrics {
+    Counter& hedges{Metrics::instance().counter("wit.message.hedges")};
+    Counter& wins{Metrics::instance().counter("wit.message.hedge_wins")};
+    Counter& denied{Metrics::instance().counter("wit.message.hedges_denied")};
+};
+
+HedgingMetrics&
+metrics()
+{
+    static HedgingMetrics instance;
+    return instance;
+}
+
+} // namespace
+
+HedgedRecognition::Ptr
+HedgedRecognition::create(std::string message,
+                          std::shared_ptr<HedgingPolicy> policy,
+                          Factory factory)
+{
+    return Ptr(new HedgedRecognition(std::move(message), std::move(policy), std::move(factory)));
+}
+
+HedgedRecognition::HedgedRecognition(std::string message,
+                                     std::shared_ptr<HedgingPolicy> policy,
+                                     Factory factory)
+    : _message{std::move(message)}
+    , _policy{std::move(policy)}
+    , _factory{std::move(factory)}
+{
+    BOOST_ASSERT(_policy);
+    BOOST_ASSERT(_factory);
+}
+
+io::awaitable<RecognitionResult>
+HedgedRecognition::run()
+{
+    _primary = _factory(_message);
+    BOOST_ASSERT(_primary);
+    onCancel().assign([weak = weak_from_this()](auto) {
+        if (auto self = weak.lock(); self) {
+            LOGD("Cancel hedged requests upon cancel request");
+            self->_primary->cancel();
+            if (self->_hedge) {
+                self->_hedge->cancel();
+            }
+        }
+    });
+
+    _policy->onRequest();
+    const auto started = HedgingPolicy::Clock::now();
+    auto result = co_await (runPrimary() || runHedge());
+    _policy->update(HedgingPolicy::Clock::now() - started);
+    co_return std::visit([](auto& r) { return std::move(r); }, result);
+}
+
+io::awaitable<RecognitionResult>
+HedgedRecognition::runPrimary()
+{
+    auto result = co_await _primary->run();
+    if (_hedge) {
+        LOGD("Cancel hedge request upon primary response");
+        _hedge->cancel();
+    }
+    co_return std::move(result);
+}
+
+io::awaitable<RecognitionResult>
+HedgedRecognition::runHedge()
+{
+    const auto delay = _policy->delay();
+    io::steady_timer timer{co_await io::this_coro::executor, delay};
+    co_await timer.async_wait(io::use_awaitable);
+
+    if (not _policy->tryHedge()) {
+        LOGD("Hedging budget is exhausted");
+        metrics().denied.increment();
+        throw sys::system_error{io::error::operation_not_supported};
+    }
+
+    LOGD("Send hedge request: delay<{}>", delay.count());
+    metrics().hedges.increment();
+    _hedge = _factory(_message);
+    BOOST_ASSERT(_hedge);
+    auto result = co_await _hedge->run();
+
+    LOGD("Cancel primary request upon hedge response");
+    metrics().wins.increment();
+    _primary->cancel();
+    co_return std::move(result);
+}
+
+} // namespace jar::wit
\ No newline at end of file
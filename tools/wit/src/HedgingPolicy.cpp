@@ -0,0 +1,108 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "wit/HedgingPolicy.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace jar::wit {
+
+namespace {
+
+/* The hedging delay until enough latency samples are collected */
+constexpr std::chrono::milliseconds kInitialDelay{500};
+/* The min number of samples to estimate the latency percentile */
+constexpr std::size_t kMinSamples{20};
+/* The max number of hedge requests might be sent in a burst */
+constexpr double kMaxTokens{10.0};
+/* The percentile of latency used as hedging delay */
+constexpr double kPercentile{0.95};
+
+} // namespace
+
+HedgingPolicy::HedgingPolicy()
+    : HedgingPolicy{Options{}}
+{
+}
+
+HedgingPolicy::HedgingPolicy(Options options)
+    : _options{options}
+{
+    BOOST_ASSERT(_options.budget >= 0.0);
+    BOOST_ASSERT(_options.delay.count() >= 0);
+}
+
+const HedgingPolicy::Options&
+HedgingPolicy::options() const
+{
+    return _options;
+}
+
+bool
+HedgingPolicy::enabled() const
+{
+    return (_options.budget > 0.0);
+}
+
+std::chrono::milliseconds
+HedgingPolicy::delay() const
+{
+    if (_options.delay.count() > 0) {
+        return _options.delay;
+    }
+
+    std::lock_guard lock{_guard};
+    if (_count < kMinSamples) {
+        return kInitialDelay;
+    }
+    std::array<double, kWindowSize> samples{_samples};
+    const auto end = samples.begin() + static_cast<std::ptrdiff_t>(_count);
+    const auto nth = samples.begin()
+                     + static_cast<std::ptrdiff_t>(
+                         std::ceil(kPercentile * static_cast<double>(_count)) - 1);
+    std::nth_element(samples.begin(), nth, end);
+    return std::chrono::milliseconds{static_cast<std::chrono::milliseconds::rep>(*nth)};
+}
+
+void
+HedgingPolicy::onRequest()
+{
+    std::lock_guard lock{_guard};
+    _tokens = std::min(_tokens + _options.budget, kMaxTokens);
+}
+
+bool
+HedgingPolicy::tryHedge()
+{
+    std::lock_guard lock{_guard};
+    if (_tokens < 1.0) {
+        return false;
+    }
+    _tokens -= 1.0;
+    return true;
+}
+
+void
+HedgingPolicy::update(Clock::duration latency)
+{
+    std::lock_guard lock{_guard};
+    _samples[_index] = std::chrono::duration<double, std::milli>(latency).count();
+    _index = (_index + 1) % kWindowSize;
+    _count = std::min(_count + 1, kWindowSize);
+}
+
+} // namespace jar::wit
\ No newline at end of file
@@ -18,6 +18,8 @@
 
 #include <boost/json.hpp>
 
+#include <array>
+
 namespace json = boost::json;
 
 namespace jar {
@@ -36,6 +38,9 @@ tag_invoke(json::value_to_tag<Timestamp>, const json::value& v)
 
 namespace jar::wit {
 
+/* The size of arena holding the DOM of typical result without touching the heap */
+static constexpr std::size_t kArenaSize{4096};
+
 static Confidence
 tag_invoke(json::value_to_tag<Confidence>, const json::value& v)
 {
@@ -188,8 +193,11 @@ IntentParser::parseMessageResult(std::string_view input)
         return std::unexpected(std::make_error_code(std::errc::invalid_argument));
     }
 
+    /* The DOM is released in one shot along with the arena */
+    std::array<unsigned char, kArenaSize> buffer;
+    json::monotonic_resource arena{buffer.data(), buffer.size()};
     std::error_code error;
-    json::value value = json::parse(input, error);
+    json::value value = json::parse(input, error, &arena);
     if (error) {
         return std::unexpected(error);
     }
@@ -210,8 +218,11 @@ IntentParser::parseSpeechResult(std::string_view input)
         return std::unexpected(std::make_error_code(std::errc::invalid_argument));
     }
 
+    std::array<unsigned char, kArenaSize> buffer;
+    json::monotonic_resource arena{buffer.data(), buffer.size()};
     wit::Utterances output;
     json::stream_parser parser;
+    parser.reset(&arena);
     std::size_t nextRoot;
     do {
         std::error_code error;
@@ -221,6 +232,7 @@ IntentParser::parseSpeechResult(std::string_view input)
         if (nextRoot > 0) {
             input = input.substr(nextRoot);
             auto value = parser.release();
+            parser.reset(&arena);
             if (auto object = value.if_object(); object) {
                 if (auto utterance = wit::toUtterance(*object); utterance) {
                     output.push_back(std::move(*utterance));
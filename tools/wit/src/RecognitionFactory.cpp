@@ -14,7 +14,12 @@
 
 #include "wit/RecognitionFactory.hpp"
 
+#include "common/Errors.hpp"
+#include "wit/BalancedRecognition.hpp"
 #include "wit/Config.hpp"
+#include "wit/FailedRecognition.hpp"
+#include "wit/GuardedRecognition.hpp"
+#include "wit/HedgedRecognition.hpp"
 #include "wit/MessageRecognition.hpp"
 #include "wit/SpeechRecognition.hpp"
 
@@ -22,41 +27,72 @@
 
 namespace jar::wit {
 
-RecognitionFactory::RecognitionFactory()
+namespace {
+
+/* The message of request to probe the backend */
+constexpr std::string_view kProbeMessage{"ping"};
+
+/* Returns the loaded config (the config with default options upon failure) */
+Config
+loadConfig()
 {
-    if (Config config; config.load()) {
-        _remoteHost = config.remoteHost();
-        _remotePort = config.remotePort();
-        _remoteAuth = config.remoteAuth();
-    } else {
+    Config config;
+    if (not config.load()) {
         LOGE("Unable to load WIT config");
+        return Config{};
+    }
+    return config;
+}
+
+} // namespace
+
+RecognitionFactory::RecognitionFactory()
+    : RecognitionFactory{loadConfig()}
+{
+}
+
+RecognitionFactory::RecognitionFactory(const Config& config)
+    : _coalescing{config.coalescing()}
+    , _breaker{std::make_shared<CircuitBreaker>(config.breaker())}
+{
+    /* The config is loaded if there is at least one backend endpoint */
+    if (not config.remotes().empty()) {
+        _balancer = std::make_shared<Balancer>(config.remotes(), config.balancer());
+        _hedging = std::make_shared<HedgingPolicy>(config.hedging());
+        LOGI("Use <{}> backend endpoints", _balancer->size());
     }
 }
 
 bool
 RecognitionFactory::canRecognizeMessage() const
 {
-    return (_remoteHost and _remotePort and _remoteAuth);
+    return static_cast<bool>(_balancer);
 }
 
 std::shared_ptr<Recognition>
-RecognitionFactory::message(io::any_io_executor executor, std::shared_ptr<DataChannel> channel)
+RecognitionFactory::message(io::any_io_executor executor, std::string message)
 {
     if (not canRecognizeMessage()) {
         throw std::logic_error{"Not supported"};
     }
-    return MessageRecognition::create(std::move(executor),
-                                      _context.ref(),
-                                      *_remoteHost,
-                                      *_remotePort,
-                                      *_remoteAuth,
-                                      std::move(channel));
+    if (not admit(executor)) {
+        return FailedRecognition::create(RecognitionErrc::Unavailable);
+    }
+    if (_hedging and _hedging->enabled()) {
+        /* Each attempt of hedged recognition might use different endpoint */
+        auto recognition = HedgedRecognition::create(
+            std::move(message), _hedging, [this, executor](std::string message) {
+                return balancedMessage(executor, std::move(message));
+            });
+        return GuardedRecognition::create(std::move(recognition), _breaker);
+    }
+    return GuardedRecognition::create(balancedMessage(executor, std::move(message)), _breaker);
 }
 
 bool
 RecognitionFactory::canRecognizeSpeech() const
 {
-    return (_remoteHost and _remotePort and _remoteAuth);
+    return static_cast<bool>(_balancer);
 }
 
 std::shared_ptr<Recognition>
@@ -65,12 +101,75 @@ RecognitionFactory::speech(io::any_io_executor executor, std::shared_ptr<DataCha
     if (not canRecognizeSpeech()) {
         throw std::logic_error{"Not supported"};
     }
-    return SpeechRecognition::create(std::move(executor),
-                                     _context.ref(),
-                                     *_remoteHost,
-                                     *_remotePort,
-                                     *_remoteAuth,
-                                     std::move(channel));
+    if (not admit(executor)) {
+        return FailedRecognition::create(std::move(channel), RecognitionErrc::Unavailable);
+    }
+    /* The duration of speech recognition covers the upload of client (it's accounted neither
+       by balancer nor by breaker as response latency of backend) */
+    auto recognition = BalancedRecognition::create(
+        _balancer,
+        [this, executor = std::move(executor), channel = std::move(channel)](const Remote& remote) {
+            return SpeechRecognition::create(executor,
+                                             _context.ref(),
+                                             remote.host,
+                                             remote.port,
+                                             remote.auth,
+                                             channel,
+                                             _coalescing);
+        },
+        BalancedRecognition::Latency::Ignored);
+    return GuardedRecognition::create(
+        std::move(recognition), _breaker, GuardedRecognition::Latency::Ignored);
+}
+
+bool
+RecognitionFactory::admit(const io::any_io_executor& executor)
+{
+    switch (_breaker->acquire()) {
+    case CircuitBreaker::Decision::Allow:
+        return true;
+    case CircuitBreaker::Decision::Probe:
+        probe(executor);
+        [[fallthrough]];
+    case CircuitBreaker::Decision::Reject:
+        break;
+    }
+    return false;
+}
+
+void
+RecognitionFactory::probe(const io::any_io_executor& executor)
+{
+    LOGI("Probe the backend availability");
+    auto recognition = balancedMessage(executor, std::string{kProbeMessage});
+    io::co_spawn(executor,
+                 recognition->run(),
+                 [breaker = _breaker, recognition](const std::exception_ptr& eptr,
+                                                   const RecognitionResult&) {
+                     bool succeeded{true};
+                     try {
+                         if (eptr) {
+                             std::rethrow_exception(eptr);
+                         }
+                     } catch (const sys::system_error& e) {
+                         LOGW("Unable to probe the backend: error<{}>", e.code().message());
+                         succeeded = false;
+                     } catch (const std::exception& e) {
+                         /* The backend has responded anyway */
+                         LOGD("Probing the backend was done: {}", e.what());
+                     }
+                     breaker->onProbe(succeeded);
+                 });
+}
+
+std::shared_ptr<Recognition>
+RecognitionFactory::balancedMessage(const io::any_io_executor& executor, std::string message)
+{
+    return BalancedRecognition::create(
+        _balancer, [this, executor, message = std::move(message)](const Remote& remote) {
+            return MessageRecognition::create(
+                executor, _context.ref(), remote.host, remote.port, remote.auth, message);
+        });
 }
 
 } // namespace jar::wit
\ No newline at end of file
@@ -14,7 +14,9 @@
 
 #include "wit/RemoteRecognition.hpp"
 
-#include <jarvisto/core/Logger.hpp>
+#include "common/Errors.hpp"
+#include "common/Logging.hpp"
+
 #include <jarvisto/network/Http.hpp>
 
 namespace jar::wit {
@@ -63,7 +65,15 @@ RemoteRecognition::RemoteRecognition(io::any_io_executor executor,
 io::awaitable<RecognitionResult>
 RemoteRecognition::run()
 {
-    co_await connect();
+    try {
+        co_await connect();
+    } catch (const sys::system_error& e) {
+        if (e.code() == io::error::operation_aborted or e.code() == sys::errc::invalid_argument) {
+            throw;
+        }
+        LOGE("Unable to connect to backend: error<{}>", e.code().message());
+        throw sys::system_error{RecognitionErrc::ConnectFailed};
+    }
     auto result = getResult(co_await process());
     co_await shutdown();
     co_return std::move(result);
@@ -93,6 +103,19 @@ RemoteRecognition::remoteAuth() const
     return _remoteAuth;
 }
 
+void
+RemoteRecognition::verifyStatus(http::status status)
+{
+    if (status == http::status::too_many_requests) {
+        LOGW("Backend throttled the request");
+        throw sys::system_error{RecognitionErrc::Throttled};
+    }
+    if (http::to_status_class(status) == http::status_class::server_error) {
+        LOGE("Backend server error: status<{}>", static_cast<unsigned>(status));
+        throw sys::system_error{RecognitionErrc::ServerError};
+    }
+}
+
 io::awaitable<void>
 RemoteRecognition::connect()
 {
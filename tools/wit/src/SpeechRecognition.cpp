@@ -14,30 +14,53 @@
 
 #include "wit/SpeechRecognition.hpp"
 
+#include "common/Logging.hpp"
+#include "common/Metrics.hpp"
 #include "wit/IntentParser.hpp"
 #include "wit/Utils.hpp"
 
-#include <jarvisto/core/Logger.hpp>
 #include <jarvisto/network/Http.hpp>
 
 #include <boost/assert.hpp>
 
 namespace jar::wit {
 
+namespace {
+
+struct SpeechMetrics {
+    Counter& chunks{Metrics::instance().counter("wit.speech.chunks")};
+    Counter& bytes{Metrics::instance().counter("wit.speech.bytes")};
+    Counter& writes{Metrics::instance().counter("wit.speech.writes")};
+    Counter& deadlines{Metrics::instance().counter("wit.speech.deadline_flushes")};
+    Histogram& chunkSize{Metrics::instance().histogram(
+        "wit.speech.chunk_size", {512, 1024, 2048, 4096, 8192, 16384})};
+};
+
+SpeechMetrics&
+metrics()
+{
+    static SpeechMetrics instance;
+    return instance;
+}
+
+} // namespace
+
 std::shared_ptr<SpeechRecognition>
 SpeechRecognition::create(io::any_io_executor executor,
                           ssl::context& context,
                           std::string host,
                           std::string port,
                           std::string auth,
-                          std::shared_ptr<Channel> channel)
+                          std::shared_ptr<Channel> channel,
+                          CoalescingPolicy::Options options)
 {
     return Ptr(new SpeechRecognition(std::move(executor),
                                      context,
                                      std::move(host),
                                      std::move(port),
                                      std::move(auth),
-                                     std::move(channel)));
+                                     std::move(channel),
+                                     options));
 }
 
 SpeechRecognition::SpeechRecognition(io::any_io_executor executor,
@@ -45,13 +68,15 @@ SpeechRecognition::SpeechRecognition(io::any_io_executor executor,
                                      std::string host,
                                      std::string port,
                                      std::string auth,
-                                     std::shared_ptr<Channel> channel)
+                                     std::shared_ptr<Channel> channel,
+                                     CoalescingPolicy::Options options)
     : RemoteRecognition{std::move(executor),
                         context,
                         std::move(host),
                         std::move(port),
                         std::move(auth)}
     , _channel{std::move(channel)}
+    , _policy{options}
 {
     BOOST_ASSERT(_channel);
 }
@@ -87,50 +112,54 @@ SpeechRecognition::process()
     n = co_await http::async_read(
         stream(), buffer, res, io::bind_cancellation_slot(onCancel(), io::use_awaitable));
     LOGD("Reading response was done: bytes<{}>", n);
+    verifyStatus(res.result());
     if (res.result() != http::status::continue_) {
         throw std::runtime_error{"Unexpected response status-code result"};
     }
 
     LOGD("Write audio chunks");
-    static const int kMinChunkSize = 512;
     n = 0;
-    io::streambuf channelBuffer;
+    std::string chunk;
     while (true) {
         onCancel().assign([channel = _channel](auto) {
             LOGD("Close channel upon cancel request");
             channel->close();
         });
-        auto outputSeq = channelBuffer.prepare(kMinChunkSize);
-        const auto [ec, size] = co_await _channel->recv(outputSeq);
+        const auto [ec, size] = co_await coalesce(chunk);
+        if (ec and ec != io::error::eof) {
+            LOGE("Unable to receive message: error<{}>", ec.message());
+            throw sys::system_error{io::error::operation_aborted};
+        }
+
+        resetTimeout(stream());
         if (size > 0) {
-            channelBuffer.commit(size);
-            const auto inputSeq = channelBuffer.data();
-            resetTimeout(stream());
-            n += co_await io::async_write(
-                stream(),
-                http::make_chunk(inputSeq),
-                io::bind_cancellation_slot(onCancel(), io::use_awaitable));
-            channelBuffer.consume(size);
+            metrics().chunks.increment();
+            metrics().bytes.increment(size);
+            metrics().chunkSize.observe(static_cast<double>(size));
         }
+        metrics().writes.increment();
+
+        /* The chunk framing and payload are written by single gathering write */
+        const auto payload = http::make_chunk(io::buffer(chunk.data(), size));
         if (ec) {
-            if (ec.value() == io::error::eof) {
-                LOGD("End of channel is reached");
-                break;
+            LOGD("End of channel is reached");
+            if (size > 0) {
+                n += co_await io::async_write(
+                    stream(),
+                    beast::buffers_cat(payload, http::make_chunk_last()),
+                    io::bind_cancellation_slot(onCancel(), io::use_awaitable));
             } else {
-                LOGE("Unable to receive message: error<{}>", ec.message());
-                throw sys::system_error{io::error::operation_aborted};
+                n += co_await io::async_write(
+                    stream(),
+                    http::make_chunk_last(),
+                    io::bind_cancellation_slot(onCancel(), io::use_awaitable));
             }
+            break;
         }
+        n += co_await io::async_write(
+            stream(), payload, io::bind_cancellation_slot(onCancel(), io::use_awaitable));
     }
-    LOGD("Writing audio chunk was done: transferred<{}>", n);
-
-    resetTimeout(stream());
-
-    LOGD("Write last audio chunk");
-    n = co_await io::async_write(stream(),
-                                 http::make_chunk_last(),
-                                 io::bind_cancellation_slot(onCancel(), io::use_awaitable));
-    LOGD("Writing last audio chunk was done: transferred<{}>", n);
+    LOGD("Writing audio chunks was done: transferred<{}>", n);
 
     resetTimeout(stream());
 
@@ -138,6 +167,7 @@ SpeechRecognition::process()
     n = co_await http::async_read(
         stream(), buffer, res, io::bind_cancellation_slot(onCancel(), io::use_awaitable));
     LOGD("Reading recognition result was done: transferred<{}>", n);
+    verifyStatus(res.result());
 
     if (auto result = IntentParser::parseSpeechResult(res.body()); result) {
         co_return std::move(result.value());
@@ -146,4 +176,28 @@ SpeechRecognition::process()
     }
 }
 
+io::awaitable<SpeechRecognition::Channel::Result>
+SpeechRecognition::coalesce(std::string& chunk)
+{
+    const std::size_t target = _policy.targetSize();
+    chunk.resize(target);
+
+    /* Wait for the first portion of data without any deadline */
+    auto [ec, size] = co_await _channel->recvSome(io::buffer(chunk.data(), target));
+    if (not ec and size < target) {
+        /* Gather the rest of chunk until it's full or the deadline is expired */
+        const auto deadline = _policy.deadline(CoalescingPolicy::Clock::now());
+        const auto result
+            = co_await _channel->recvUntil(io::buffer(chunk.data() + size, target - size), deadline);
+        ec = result.error;
+        size += result.size;
+        if (not ec and size < target) {
+            metrics().deadlines.increment();
+        }
+    }
+
+    _policy.update(size, CoalescingPolicy::Clock::now());
+    co_return Channel::Result{.error = ec, .size = size};
+}
+
 } // namespace jar::wit
\ No newline at end of file
@@ -0,0 +1,138 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "common/Errors.hpp"
+#include "wit/BalancedRecognition.hpp"
+
+#include <functional>
+#include <optional>
+
+using namespace jar;
+using namespace testing;
+
+namespace {
+
+class FakeRecognition final : public Recognition {
+public:
+    explicit FakeRecognition(std::function<RecognitionResult()> callback)
+        : _callback{std::move(callback)}
+    {
+    }
+
+    io::awaitable<RecognitionResult>
+    run() final
+    {
+        co_return _callback();
+    }
+
+private:
+    std::function<RecognitionResult()> _callback;
+};
+
+} // namespace
+
+class WitBalancedRecognitionTest : public Test {
+public:
+    WitBalancedRecognitionTest()
+        : balancer{std::make_shared<wit::Balancer>(std::vector<wit::Remote>{
+              {.host = "api.wit.ai", .port = "https", .auth = "0"}})}
+    {
+    }
+
+    std::optional<RecognitionResult>
+    run(std::shared_ptr<Recognition> recognition)
+    {
+        std::optional<RecognitionResult> output;
+        io::co_spawn(context, recognition->run(), [&](auto eptr, RecognitionResult result) {
+            if (not eptr) {
+                output = std::move(result);
+            }
+        });
+        context.run();
+        context.restart();
+        return output;
+    }
+
+    io::io_context context;
+    std::shared_ptr<wit::Balancer> balancer;
+};
+
+TEST_F(WitBalancedRecognitionTest, Run)
+{
+    std::size_t outstanding{};
+    auto recognition
+        = wit::BalancedRecognition::create(balancer, [&](const wit::Remote& remote) {
+              EXPECT_EQ(remote.auth, "0");
+              return std::make_shared<FakeRecognition>([&]() {
+                  outstanding = balancer->outstanding(0);
+                  return RecognitionResult{.isUnderstood = true, .intent = "light_on"};
+              });
+          });
+
+    const auto result = run(recognition);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->isUnderstood);
+    EXPECT_EQ(outstanding, 1U);
+    EXPECT_EQ(balancer->outstanding(0), 0U);
+    EXPECT_TRUE(balancer->latency(0));
+}
+
+TEST_F(WitBalancedRecognitionTest, IgnoredLatency)
+{
+    auto recognition = wit::BalancedRecognition::create(
+        balancer,
+        [&](const wit::Remote& /*remote*/) {
+            return std::make_shared<FakeRecognition>([]() {
+                return RecognitionResult{.isUnderstood = true, .intent = "light_on"};
+            });
+        },
+        wit::BalancedRecognition::Latency::Ignored);
+
+    /* The endpoint is released without latency sample (e.g. for streaming speech) */
+    ASSERT_TRUE(run(recognition));
+    EXPECT_EQ(balancer->outstanding(0), 0U);
+    EXPECT_FALSE(balancer->latency(0));
+}
+
+TEST_F(WitBalancedRecognitionTest, NotRun)
+{
+    bool created{false};
+    auto recognition
+        = wit::BalancedRecognition::create(balancer, [&](const wit::Remote& /*remote*/) {
+              created = true;
+              return std::make_shared<FakeRecognition>([]() { return RecognitionResult{}; });
+          });
+    recognition.reset();
+
+    /* The endpoint isn't acquired by the recognition which is never run */
+    EXPECT_FALSE(created);
+    EXPECT_EQ(balancer->outstanding(0), 0U);
+}
+
+TEST_F(WitBalancedRecognitionTest, Throttled)
+{
+    auto recognition
+        = wit::BalancedRecognition::create(balancer, [&](const wit::Remote& /*remote*/) {
+              return std::make_shared<FakeRecognition>([]() -> RecognitionResult {
+                  throw sys::system_error{RecognitionErrc::Throttled};
+              });
+          });
+
+    EXPECT_FALSE(run(recognition));
+    EXPECT_EQ(balancer->outstanding(0), 0U);
+    EXPECT_TRUE(balancer->ejected(0));
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "wit/Balancer.hpp"
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+std::vector<wit::Remote>
+makeRemotes(std::size_t count)
+{
+    std::vector<wit::Remote> remotes;
+    for (std::size_t n = 0; n < count; ++n) {
+        remotes.push_back({.host = "api.wit.ai", .port = "https", .auth = std::to_string(n)});
+    }
+    return remotes;
+}
+
+} // namespace
+
+TEST(WitBalancerTest, LeastOutstanding)
+{
+    wit::Balancer balancer{makeRemotes(2)};
+    const auto now = wit::Balancer::Clock::now();
+
+    const auto index1 = balancer.acquire(now);
+    const auto index2 = balancer.acquire(now);
+    EXPECT_NE(index1, index2);
+    EXPECT_EQ(balancer.outstanding(index1), 1U);
+    EXPECT_EQ(balancer.outstanding(index2), 1U);
+
+    balancer.release(index1, wit::Balancer::Outcome::Success, 100ms, now);
+    balancer.release(index2, wit::Balancer::Outcome::Success, 300ms, now);
+    EXPECT_THAT(balancer.latency(index1), Optional(DoubleEq(100.0)));
+
+    /* The tie is resolved by the lowest latency */
+    EXPECT_EQ(balancer.acquire(now), index1);
+    EXPECT_EQ(balancer.acquire(now), index2);
+}
+
+TEST(WitBalancerTest, EjectThrottled)
+{
+    wit::Balancer balancer{makeRemotes(2), {.ejectDuration = 1s, .maxFailures = 2}};
+    auto now = wit::Balancer::Clock::now();
+
+    auto index = balancer.acquire(now);
+    balancer.release(index, wit::Balancer::Outcome::Throttled, 10ms, now);
+    EXPECT_TRUE(balancer.ejected(index, now));
+
+    const auto other = balancer.acquire(now);
+    EXPECT_NE(other, index);
+    balancer.release(other, wit::Balancer::Outcome::Success, 10ms, now);
+    EXPECT_EQ(balancer.acquire(now), other);
+    balancer.release(other, wit::Balancer::Outcome::Success, 10ms, now);
+
+    now += 1s;
+    EXPECT_FALSE(balancer.ejected(index, now));
+}
+
+TEST(WitBalancerTest, EjectFailed)
+{
+    wit::Balancer balancer{makeRemotes(1), {.ejectDuration = 1s, .maxFailures = 2}};
+    const auto now = wit::Balancer::Clock::now();
+
+    balancer.release(balancer.acquire(now), wit::Balancer::Outcome::Failed, 10ms, now);
+    EXPECT_FALSE(balancer.ejected(0, now));
+    balancer.release(balancer.acquire(now), wit::Balancer::Outcome::Failed, 10ms, now);
+    EXPECT_TRUE(balancer.ejected(0, now));
+
+    /* The only endpoint is still used being ejected */
+    EXPECT_EQ(balancer.acquire(now), 0U);
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "wit/CircuitBreaker.hpp"
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+using Breaker = wit::CircuitBreaker;
+
+TEST(WitCircuitBreakerTest, OpenUponFailures)
+{
+    Breaker breaker{{.failureRate = 0.5, .minRequests = 4, .windowSize = 4}};
+    const auto now = Breaker::Clock::now();
+
+    breaker.onSuccess(10ms, now);
+    breaker.onFailure(now);
+    breaker.onSuccess(10ms, now);
+    EXPECT_THAT(breaker.state(), Eq(Breaker::State::Closed));
+    EXPECT_THAT(breaker.acquire(now), Eq(Breaker::Decision::Allow));
+
+    /* The slow request is considered as failure */
+    breaker.onSuccess(10s, now);
+    EXPECT_THAT(breaker.state(), Eq(Breaker::State::Open));
+    EXPECT_THAT(breaker.acquire(now), Eq(Breaker::Decision::Reject));
+}
+
+TEST(WitCircuitBreakerTest, UnknownLatency)
+{
+    Breaker breaker{{.failureRate = 0.5, .minRequests = 2, .windowSize = 2, .slowDuration = 0ms}};
+    const auto now = Breaker::Clock::now();
+
+    /* The request with unknown latency is never considered as slow */
+    breaker.onSuccess(std::nullopt, now);
+    breaker.onSuccess(std::nullopt, now);
+    EXPECT_THAT(breaker.state(), Eq(Breaker::State::Closed));
+    EXPECT_THAT(breaker.acquire(now), Eq(Breaker::Decision::Allow));
+}
+
+TEST(WitCircuitBreakerTest, ProbeWhenHalfOpen)
+{
+    Breaker breaker{{.failureRate = 0.5, .minRequests = 1, .windowSize = 1, .openDuration = 1s}};
+    auto now = Breaker::Clock::now();
+
+    breaker.onFailure(now);
+    EXPECT_THAT(breaker.acquire(now + 500ms), Eq(Breaker::Decision::Reject));
+
+    now += 1s;
+    EXPECT_THAT(breaker.acquire(now), Eq(Breaker::Decision::Probe));
+    EXPECT_THAT(breaker.state(), Eq(Breaker::State::HalfOpen));
+    EXPECT_THAT(breaker.acquire(now), Eq(Breaker::Decision::Reject));
+
+    breaker.onProbe(false, now);
+    EXPECT_THAT(breaker.state(), Eq(Breaker::State::Open));
+
+    now += 1s;
+    EXPECT_THAT(breaker.acquire(now), Eq(Breaker::Decision::Probe));
+    breaker.onProbe(true, now);
+    EXPECT_THAT(breaker.state(), Eq(Breaker::State::Closed));
+    EXPECT_THAT(breaker.acquire(now), Eq(Breaker::Decision::Allow));
+}
\ No newline at end of file
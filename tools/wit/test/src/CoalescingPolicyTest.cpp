@@ -0,0 +1,67 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "wit/CoalescingPolicy.hpp"
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+TEST(WitCoalescingPolicyTest, MinChunkSizeWithoutRate)
+{
+    wit::CoalescingPolicy policy;
+    EXPECT_FALSE(policy.rate());
+    EXPECT_THAT(policy.targetSize(), Eq(policy.options().minChunkSize));
+}
+
+TEST(WitCoalescingPolicyTest, FollowIncomingRate)
+{
+    wit::CoalescingPolicy policy{{.minChunkSize = 512, .maxChunkSize = 16000, .maxDelay = 100ms}};
+
+    /* 16kHz, mono, S16LE gives 32000 bytes per second */
+    auto now = wit::CoalescingPolicy::Clock::now();
+    for (int n = 0; n < 20; ++n) {
+        policy.update(3200, now);
+        now += 100ms;
+    }
+    ASSERT_TRUE(policy.rate());
+    EXPECT_THAT(*policy.rate(), DoubleNear(32000.0, 1.0));
+    EXPECT_THAT(policy.targetSize(), Eq(3200U));
+}
+
+TEST(WitCoalescingPolicyTest, ClampTargetSize)
+{
+    wit::CoalescingPolicy policy{{.minChunkSize = 512, .maxChunkSize = 4096, .maxDelay = 100ms}};
+
+    auto now = wit::CoalescingPolicy::Clock::now();
+    policy.update(1'000'000, now);
+    policy.update(1'000'000, now + 100ms);
+    EXPECT_THAT(policy.targetSize(), Eq(4096U));
+
+    policy = wit::CoalescingPolicy{{.minChunkSize = 512, .maxChunkSize = 4096, .maxDelay = 100ms}};
+    policy.update(10, now);
+    policy.update(10, now + 1s);
+    EXPECT_THAT(policy.targetSize(), Eq(512U));
+}
+
+TEST(WitCoalescingPolicyTest, Deadline)
+{
+    wit::CoalescingPolicy policy{{.maxDelay = 50ms}};
+    const auto now = wit::CoalescingPolicy::Clock::now();
+    EXPECT_THAT(policy.deadline(now), Eq(now + 50ms));
+}
\ No newline at end of file
@@ -30,6 +30,23 @@ wit =
         port = "https";
         auth = "Bearer 123456789";
     };
+    speech =
+    {
+        chunkMinSize = 1024;
+        chunkMaxSize = 8192;
+        chunkMaxDelay = 200;
+    };
+    message =
+    {
+        hedgingDelay = 300;
+        hedgingBudget = 10;
+    };
+    breaker =
+    {
+        failureRate = 25;
+        slowDuration = 2000;
+        openDuration = 5000;
+    };
 };
 )";
 
@@ -41,4 +58,40 @@ TEST(WitConfigTest, Load)
     EXPECT_EQ(config.remoteHost(), "api.wit.ai");
     EXPECT_EQ(config.remotePort(), "https");
     EXPECT_EQ(config.remoteAuth(), "Bearer 123456789");
+    EXPECT_EQ(config.coalescing().minChunkSize, 1024U);
+    EXPECT_EQ(config.coalescing().maxChunkSize, 8192U);
+    EXPECT_EQ(config.coalescing().maxDelay, std::chrono::milliseconds{200});
+    EXPECT_EQ(config.hedging().delay, std::chrono::milliseconds{300});
+    EXPECT_DOUBLE_EQ(config.hedging().budget, 0.1);
+    EXPECT_DOUBLE_EQ(config.breaker().failureRate, 0.25);
+    EXPECT_EQ(config.breaker().slowDuration, std::chrono::milliseconds{2000});
+    EXPECT_EQ(config.breaker().openDuration, std::chrono::milliseconds{5000});
 }
+
+TEST(WitConfigTest, LoadRemotes)
+{
+    static const std::string_view kValue = R"(
+wit =
+{
+    remotes =
+    (
+        { host = "api.wit.ai"; port = "https"; auth = "Bearer 1"; },
+        { host = "api.wit.ai"; port = "https"; auth = "Bearer 2"; }
+    );
+    balancer =
+    {
+        ejectDuration = 5000;
+        maxFailures = 5;
+    };
+};
+)";
+
+    wit::Config config;
+    ASSERT_TRUE(config.load(kValue));
+
+    ASSERT_EQ(config.remotes().size(), 2U);
+    EXPECT_EQ(config.remotes()[1].auth, "Bearer 2");
+    EXPECT_EQ(config.remoteAuth(), "Bearer 1");
+    EXPECT_EQ(config.balancer().ejectDuration, std::chrono::milliseconds{5000});
+    EXPECT_EQ(config.balancer().maxFailures, 5U);
+}
\ No newline at end of file
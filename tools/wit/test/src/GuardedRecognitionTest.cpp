@@ -0,0 +1,102 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "wit/GuardedRecognition.hpp"
+#include "wit/HedgedRecognition.hpp"
+
+#include <chrono>
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/* The recognition responding after given delay */
+class SlowRecognition final : public Recognition {
+public:
+    explicit SlowRecognition(std::chrono::milliseconds delay)
+        : _delay{delay}
+    {
+    }
+
+    io::awaitable<RecognitionResult>
+    run() final
+    {
+        io::steady_timer timer{co_await io::this_coro::executor, _delay};
+        co_await timer.async_wait(io::use_awaitable);
+        co_return RecognitionResult{.isUnderstood = true, .intent = "light_on"};
+    }
+
+private:
+    std::chrono::milliseconds _delay;
+};
+
+} // namespace
+
+class WitGuardedRecognitionTest : public Test {
+public:
+    WitGuardedRecognitionTest()
+        : breaker{std::make_shared<wit::CircuitBreaker>(wit::CircuitBreaker::Options{
+              .failureRate = 0.5, .minRequests = 2, .windowSize = 2, .slowDuration = 10ms})}
+        , hedging{std::make_shared<wit::HedgingPolicy>(
+              wit::HedgingPolicy::Options{.delay = 1000ms, .budget = 0.05})}
+    {
+    }
+
+    std::shared_ptr<Recognition>
+    hedgedMessage(std::chrono::milliseconds delay)
+    {
+        return wit::HedgedRecognition::create(
+            "turn on the light", hedging, [delay](std::string /*message*/) {
+                return std::make_shared<SlowRecognition>(delay);
+            });
+    }
+
+    void
+    run(std::shared_ptr<Recognition> recognition)
+    {
+        io::co_spawn(context, recognition->run(), io::detached);
+        context.run();
+        context.restart();
+    }
+
+    io::io_context context;
+    std::shared_ptr<wit::CircuitBreaker> breaker;
+    std::shared_ptr<wit::HedgingPolicy> hedging;
+};
+
+TEST_F(WitGuardedRecognitionTest, SlowHedgedMessage)
+{
+    ASSERT_TRUE(hedging->enabled());
+
+    /* The slow responses of backend are considered as failures */
+    run(wit::GuardedRecognition::create(hedgedMessage(50ms), breaker));
+    run(wit::GuardedRecognition::create(hedgedMessage(50ms), breaker));
+    EXPECT_THAT(breaker->state(), Eq(wit::CircuitBreaker::State::Open));
+}
+
+TEST_F(WitGuardedRecognitionTest, IgnoredLatency)
+{
+    using Latency = wit::GuardedRecognition::Latency;
+
+    /* The latency of streaming recognition isn't accounted */
+    run(wit::GuardedRecognition::create(hedgedMessage(50ms), breaker, Latency::Ignored));
+    run(wit::GuardedRecognition::create(hedgedMessage(50ms), breaker, Latency::Ignored));
+    EXPECT_THAT(breaker->state(), Eq(wit::CircuitBreaker::State::Closed));
+}
\ No newline at end of file
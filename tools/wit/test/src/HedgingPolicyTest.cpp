@@ -0,0 +1,55 @@
+// Copyright 2025 Denys Asauliak
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "wit/HedgingPolicy.hpp"
+
+using namespace jar;
+using namespace testing;
+
+using namespace std::chrono_literals;
+
+TEST(WitHedgingPolicyTest, FixedDelay)
+{
+    wit::HedgingPolicy policy{{.delay = 250ms, .budget = 0.1}};
+    EXPECT_TRUE(policy.enabled());
+    policy.update(1s);
+    EXPECT_THAT(policy.delay(), Eq(250ms));
+}
+
+TEST(WitHedgingPolicyTest, AdaptiveDelay)
+{
+    wit::HedgingPolicy policy{{.delay = 0ms, .budget = 0.1}};
+    for (int n = 1; n <= 100; ++n) {
+        policy.update(std::chrono::milliseconds{n * 10});
+    }
+    EXPECT_THAT(policy.delay(), Eq(950ms));
+}
+
+TEST(WitHedgingPolicyTest, Budget)
+{
+    wit::HedgingPolicy policy{{.delay = 0ms, .budget = 0.25}};
+    EXPECT_FALSE(policy.tryHedge());
+
+    for (int n = 0; n < 4; ++n) {
+        policy.onRequest();
+    }
+    EXPECT_TRUE(policy.tryHedge());
+    EXPECT_FALSE(policy.tryHedge());
+
+    wit::HedgingPolicy disabled{{.delay = 0ms, .budget = 0.0}};
+    EXPECT_FALSE(disabled.enabled());
+}
\ No newline at end of file
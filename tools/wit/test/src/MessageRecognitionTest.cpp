@@ -19,7 +19,6 @@
 #include "wit/Matchers.hpp"
 #include "wit/MessageRecognition.hpp"
 #include "wit/RecognitionFactory.hpp"
-#include "wit/Utils.hpp"
 
 #include <jarvisto/network/SecureContext.hpp>
 
@@ -31,8 +30,6 @@ using namespace jar;
 
 class WitMessageRecognitionTest : public Test {
 public:
-    const std::size_t kChannelCapacity{64};
-
     static void
     SetUpTestSuite()
     {
@@ -57,9 +54,7 @@ TEST_F(WitMessageRecognitionTest, RecognizeMessage)
     MockFunction<void(std::exception_ptr, RecognitionResult)> callback1;
     EXPECT_CALL(callback1, Call(IsFalse(), understoodIntent("light_turn_off_bedroom")));
 
-    auto executor = context.get_executor();
-    auto channel = std::make_shared<wit::MessageRecognition::Channel>(executor, 128);
-    auto recognition = factory.message(executor, channel);
+    auto recognition = factory.message(context.get_executor(), std::string{kMessage});
 
     /* Spawn recognition coroutine */
     io::co_spawn(
@@ -74,26 +69,13 @@ TEST_F(WitMessageRecognitionTest, RecognizeMessage)
             }
         });
 
-    /* Spawn data provider coroutine */
-    io::co_spawn(
-        context.get_executor(),
-        [channel]() -> io::awaitable<void> {
-            std::string message = wit::messageTargetWithDate(kMessage);
-            std::ignore = co_await channel->send(io::buffer(message));
-            co_await channel->send(io::error::eof);
-            channel->close();
-        },
-        [&](const std::exception_ptr& eptr) {
-            if (eptr) {
-                context.stop();
-            }
-        });
-
     context.run();
 }
 
 TEST_F(WitMessageRecognitionTest, CancelRecognizeMessage)
 {
+    static const std::string_view kMessage{"turn on the light in the kitchen"};
+
     io::io_context context{1};
 
     MockFunction<void(std::exception_ptr, RecognitionResult)> callback;
@@ -101,9 +83,15 @@ TEST_F(WitMessageRecognitionTest, CancelRecognizeMessage)
                 Call(Truly(exceptionContainsError(Eq(sys::errc::operation_canceled))),
                      notUnderstoodIntent()));
 
-    auto executor = context.get_executor();
-    auto channel = std::make_shared<wit::MessageRecognition::Channel>(executor, kChannelCapacity);
-    auto recognition = factory.message(executor, channel);
+    /* The local backend accepts the connection but never responds */
+    tcp::acceptor acceptor{context, tcp::endpoint{io::ip::make_address_v4("127.0.0.1"), 0}};
+    const auto port = std::to_string(acceptor.local_endpoint().port());
+    auto recognition = wit::MessageRecognition::create(context.get_executor(),
+                                                       secureContext.ref(),
+                                                       "127.0.0.1",
+                                                       port,
+                                                       "Bearer token",
+                                                       std::string{kMessage});
 
     /* Spawn recognition coroutine */
     io::co_spawn(
@@ -113,14 +101,12 @@ TEST_F(WitMessageRecognitionTest, CancelRecognizeMessage)
         },
         callback.AsStdFunction());
 
-    /* Spawn cancellation timer */
-    const std::chrono::milliseconds kCancelAfter{50};
+    /* Spawn backend coroutine cancelling recognition once it's connected */
+    tcp::socket peer{context};
     io::co_spawn(
         context.get_executor(),
         [&]() -> io::awaitable<void> {
-            io::steady_timer timer{context.get_executor()};
-            timer.expires_after(std::chrono::milliseconds{kCancelAfter});
-            co_await timer.async_wait(io::use_awaitable);
+            co_await acceptor.async_accept(peer, io::use_awaitable);
             recognition->cancel();
         },
         io::detached);